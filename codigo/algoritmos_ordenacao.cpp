@@ -1,142 +1,415 @@
 #include "algoritmos_ordenacao.h"
+#include "pool_tarefas.h"
+#include "ordenacao_simd.h"
+#include "ordenacao_generica.h"
+#include "ordenacao_adaptativa.h"
 #include <iostream>
+#include <execution>
+#include <cstring>
+#include <limits>
 
 using namespace std;
 
+// Os núcleos genéricos estão em ordenacao_generica.h e
+// ordenacao_adaptativa.h; as funções abaixo
+// são as sobrecargas para vector<double> usadas pelo Benchmark
+
 // Insertion Sort
 void AlgoritmosOrdenacao::insertionSort(vector<double>& arr) {
-    int n = arr.size();
-    for (int i = 1; i < n; i++) {
-        double key = arr[i];
-        int j = i - 1;
-        
-        while (j >= 0 && arr[j] > key) {
-            arr[j + 1] = arr[j];
-            j--;
-        }
-        arr[j + 1] = key;
-    }
+    ordenacao::insertionSort(arr.begin(), arr.end());
 }
 
 // Shell Sort
 void AlgoritmosOrdenacao::shellSort(vector<double>& arr) {
-    int n = arr.size();
-    
-    // Sequência de gaps (Knuth)
-    for (int gap = n / 2; gap > 0; gap /= 2) {
-        for (int i = gap; i < n; i++) {
-            double temp = arr[i];
-            int j;
-            
-            for (j = i; j >= gap && arr[j - gap] > temp; j -= gap) {
-                arr[j] = arr[j - gap];
-            }
-            arr[j] = temp;
-        }
+    ordenacao::shellSort(arr.begin(), arr.end());
+}
+
+// Cada sequência é um parâmetro de template: o switch só escolhe a instância
+template <class Compare, class Politica>
+static void shellSortComSequencia(vector<double>& arr, SequenciaGaps sequencia, Compare comp,
+                                  Politica& politica) {
+    switch (sequencia) {
+        case SequenciaGaps::Shell:
+            ordenacao::shellSort<ordenacao::SequenciaShell>(arr.begin(), arr.end(), comp, politica);
+            break;
+        case SequenciaGaps::Knuth:
+            ordenacao::shellSort<ordenacao::SequenciaKnuth>(arr.begin(), arr.end(), comp, politica);
+            break;
+        case SequenciaGaps::Sedgewick:
+            ordenacao::shellSort<ordenacao::SequenciaSedgewick>(arr.begin(), arr.end(), comp, politica);
+            break;
+        case SequenciaGaps::Tokuda:
+            ordenacao::shellSort<ordenacao::SequenciaTokuda>(arr.begin(), arr.end(), comp, politica);
+            break;
+        case SequenciaGaps::Ciura:
+            ordenacao::shellSort<ordenacao::SequenciaCiura>(arr.begin(), arr.end(), comp, politica);
+            break;
+        case SequenciaGaps::Pratt:
+            ordenacao::shellSort<ordenacao::SequenciaPratt>(arr.begin(), arr.end(), comp, politica);
+            break;
     }
 }
 
+void AlgoritmosOrdenacao::shellSort(vector<double>& arr, SequenciaGaps sequencia) {
+    ordenacao::SemContagem semContagem;
+    shellSortComSequencia(arr, sequencia, less<>(), semContagem);
+}
+
 // Quick Sort - função principal
 void AlgoritmosOrdenacao::quickSort(vector<double>& arr) {
-    if (arr.size() <= 1) return;
-    quickSort(arr, 0, arr.size() - 1);
+    ordenacao::quickSort(arr.begin(), arr.end());
 }
 
-// Quick Sort - recursivo
-void AlgoritmosOrdenacao::quickSort(vector<double>& arr, int low, int high) {
+// Quick Sort - intervalo fechado [low, high]
+void AlgoritmosOrdenacao::quickSort(vector<double>& arr, ptrdiff_t low, ptrdiff_t high) {
     if (low < high) {
-        int pi = partition(arr, low, high);
-        
-        quickSort(arr, low, pi - 1);
-        quickSort(arr, pi + 1, high);
+        ordenacao::quickSort(arr.begin() + low, arr.begin() + high + 1);
     }
 }
 
 // Partição para Quick Sort
-int AlgoritmosOrdenacao::partition(vector<double>& arr, int low, int high) {
-    double pivot = arr[high];
-    int i = (low - 1);
-    
-    for (int j = low; j <= high - 1; j++) {
-        if (arr[j] < pivot) {
-            i++;
-            swap(arr[i], arr[j]);
-        }
-    }
-    swap(arr[i + 1], arr[high]);
-    return (i + 1);
+ptrdiff_t AlgoritmosOrdenacao::partition(vector<double>& arr, ptrdiff_t low, ptrdiff_t high) {
+    return ordenacao::partition(arr.begin() + low, arr.begin() + high + 1) - arr.begin();
 }
 
 // Introsort - implementação manual
 void AlgoritmosOrdenacao::introsort(vector<double>& arr) {
+    ordenacao::introsort(arr.begin(), arr.end());
+}
+
+// Introsort para colunas de códigos inteiros (partição sem desvios)
+void AlgoritmosOrdenacao::introsort(vector<int64_t>& arr) {
+    ordenacao::introsort(arr.begin(), arr.end());
+}
+
+void AlgoritmosOrdenacao::introsort(vector<int32_t>& arr) {
+    ordenacao::introsort(arr.begin(), arr.end());
+}
+
+// Versões com contagem de operações: o comparador é envolvido uma vez
+// aqui e os núcleos repassam a política entre si
+void AlgoritmosOrdenacao::insertionSort(vector<double>& arr, ContagemOperacoes& contagem) {
+    ordenacao::insertionSort(arr.begin(), arr.end(),
+                             ordenacao::contarComparacoes(less<>(), contagem), contagem);
+}
+
+void AlgoritmosOrdenacao::shellSort(vector<double>& arr, ContagemOperacoes& contagem) {
+    ordenacao::shellSort(arr.begin(), arr.end(),
+                         ordenacao::contarComparacoes(less<>(), contagem), contagem);
+}
+
+void AlgoritmosOrdenacao::shellSort(vector<double>& arr, SequenciaGaps sequencia,
+                                    ContagemOperacoes& contagem) {
+    shellSortComSequencia(arr, sequencia, ordenacao::contarComparacoes(less<>(), contagem),
+                          contagem);
+}
+
+void AlgoritmosOrdenacao::quickSort(vector<double>& arr, ContagemOperacoes& contagem) {
+    ordenacao::quickSort(arr.begin(), arr.end(),
+                         ordenacao::contarComparacoes(less<>(), contagem), contagem);
+}
+
+void AlgoritmosOrdenacao::introsort(vector<double>& arr, ContagemOperacoes& contagem) {
+    ordenacao::introsort(arr.begin(), arr.end(),
+                         ordenacao::contarComparacoes(less<>(), contagem), contagem);
+}
+
+// Pattern-defeating quicksort (partição em blocos sem desvios)
+void AlgoritmosOrdenacao::pdqSort(vector<double>& arr) {
+    ordenacao::pdqsort(arr.begin(), arr.end());
+}
+
+// Powersort (estável, adaptativo a runs já ordenados)
+void AlgoritmosOrdenacao::powerSort(vector<double>& arr) {
+    ordenacao::powersort(arr.begin(), arr.end());
+}
+
+// Merge Sort estável (bottom-up, buffer reaproveitado da arena)
+void AlgoritmosOrdenacao::mergeSort(vector<double>& arr) {
+    ordenacao::mergeSort(arr.begin(), arr.end());
+}
+
+void AlgoritmosOrdenacao::stableSort(vector<double>& arr) {
+    stable_sort(arr.begin(), arr.end());
+}
+
+void AlgoritmosOrdenacao::reordenarIncremental(vector<double>& arr, size_t tamanhoOrdenado) {
+    tamanhoOrdenado = min(tamanhoOrdenado, arr.size());
+    ordenacao::reordenarIncremental(arr.begin(), arr.begin() + tamanhoOrdenado, arr.end());
+}
+
+void AlgoritmosOrdenacao::atualizarOrdenado(vector<double>& arr,
+                                            const vector<pair<size_t, double>>& alteracoes) {
+    ordenacao::atualizarOrdenado(arr, alteracoes);
+}
+
+// Partial sort (heap dos k menores ou seleção + introsort do prefixo)
+void AlgoritmosOrdenacao::partialSort(vector<double>& arr, size_t k) {
+    k = min(k, arr.size());
+    ordenacao::partialSort(arr.begin(), arr.begin() + k, arr.end());
+}
+
+// Introselect com fallback para mediana das medianas
+void AlgoritmosOrdenacao::nthElement(vector<double>& arr, size_t k) {
+    if (k >= arr.size()) return;
+    ordenacao::nthElement(arr.begin(), arr.begin() + k, arr.end());
+}
+
+void AlgoritmosOrdenacao::introsortUtil(vector<double>& arr, ptrdiff_t begin, ptrdiff_t end, int depthLimit) {
+    ordenacao::introsortUtil(arr.begin() + begin, arr.begin() + end + 1, depthLimit);
+}
+
+// Introsort SIMD - mesma estrutura do manual (pivô em arr[end], limite de
+// profundidade, heapSort), trocando a partição de Lomuto pela vetorial e o
+// insertion sort das folhas pela rede de ordenação
+void AlgoritmosOrdenacao::introsortSIMD(vector<double>& arr) {
     if (arr.size() <= 1) return;
     
     int depthLimit = calculateDepthLimit(arr.size());
-    introsortUtil(arr, 0, arr.size() - 1, depthLimit);
+    introsortSIMDUtil(arr, 0, arr.size() - 1, depthLimit);
 }
 
-void AlgoritmosOrdenacao::introsortUtil(vector<double>& arr, int begin, int end, int depthLimit) {
-    int size = end - begin + 1;
+void AlgoritmosOrdenacao::introsortSIMDUtil(vector<double>& arr, ptrdiff_t begin, ptrdiff_t end, int depthLimit) {
+    ptrdiff_t size = end - begin + 1;
     
-    // Se o tamanho for pequeno, usa insertion sort
-    if (size <= 16) {
-        vector<double> subArr(arr.begin() + begin, arr.begin() + end + 1);
-        insertionSort(subArr);
-        for (int i = 0; i < subArr.size(); i++) {
-            arr[begin + i] = subArr[i];
-        }
+    if (size <= static_cast<ptrdiff_t>(OrdenacaoSIMD::TAMANHO_REDE)) {
+        sortSmall(arr.data() + begin, size);
         return;
     }
     
-    // Se a profundidade limite foi atingida, usa heap sort
     if (depthLimit == 0) {
         heapSort(arr, begin, end);
         return;
     }
     
-    // Caso contrário, usa quick sort
-    int pivot = partition(arr, begin, end);
-    introsortUtil(arr, begin, pivot - 1, depthLimit - 1);
-    introsortUtil(arr, pivot + 1, end, depthLimit - 1);
+    double pivotValue = arr[end];
+    ptrdiff_t pivot = begin + OrdenacaoSIMD::particionar(arr.data() + begin, size - 1, pivotValue);
+    swap(arr[pivot], arr[end]);
+    
+    introsortSIMDUtil(arr, begin, pivot - 1, depthLimit - 1);
+    introsortSIMDUtil(arr, pivot + 1, end, depthLimit - 1);
+}
+
+void AlgoritmosOrdenacao::sortSmall(double* dados, size_t n) {
+    OrdenacaoSIMD::ordenarBloco(dados, n);
+}
+
+void AlgoritmosOrdenacao::heapSort(vector<double>& arr, ptrdiff_t begin, ptrdiff_t end) {
+    ordenacao::heapSort(arr.begin() + begin, arr.begin() + end + 1);
+}
+
+int AlgoritmosOrdenacao::calculateDepthLimit(ptrdiff_t n) {
+    return ordenacao::calculateDepthLimit(n);
+}
+
+// std::sort para comparação
+void AlgoritmosOrdenacao::stdSort(vector<double>& arr) {
+    sort(arr.begin(), arr.end());
+}
+
+// std::sort paralelo (backend TBB quando disponível, senão serial)
+void AlgoritmosOrdenacao::stdSortParallel(vector<double>& arr) {
+    sort(execution::par, arr.begin(), arr.end());
 }
 
-void AlgoritmosOrdenacao::heapSort(vector<double>& arr, int begin, int end) {
-    int n = end - begin + 1;
+// Abaixo deste tamanho uma partição é ordenada sequencialmente pela própria tarefa
+static const ptrdiff_t LIMIAR_PARALELO = 1 << 14;
+
+// Introsort paralelo - função principal
+void AlgoritmosOrdenacao::parallelSort(vector<double>& arr, unsigned numThreads) {
+    if (arr.size() <= 1) return;
+    
+    PoolTarefas& pool = PoolTarefas::compartilhado(numThreads);
+    int depthLimit = calculateDepthLimit(arr.size());
+    atomic<size_t> pendentes(1);
     
-    // Constrói o heap
-    for (int i = n / 2 - 1; i >= 0; i--) {
-        heapify(arr, n, i, begin);
+    pool.submeter([&arr, &pool, &pendentes, depthLimit]() {
+        parallelSortUtil(arr, 0, arr.size() - 1, depthLimit, pool, pendentes);
+    });
+    pool.aguardar(pendentes);
+}
+
+void AlgoritmosOrdenacao::parallelSortUtil(vector<double>& arr, ptrdiff_t begin, ptrdiff_t end, int depthLimit,
+                                           PoolTarefas& pool, atomic<size_t>& pendentes) {
+    // Particiona enquanto o trecho for grande: a metade esquerda vira uma nova
+    // tarefa e a direita continua nesta mesma tarefa
+    while (end - begin + 1 > LIMIAR_PARALELO && depthLimit > 0) {
+        medianOfThree(arr, begin, end);
+        ptrdiff_t pivot = partition(arr, begin, end);
+        depthLimit--;
+        
+        ptrdiff_t leftEnd = pivot - 1;
+        pendentes++;
+        pool.submeter([&arr, &pool, &pendentes, begin, leftEnd, depthLimit]() {
+            parallelSortUtil(arr, begin, leftEnd, depthLimit, pool, pendentes);
+        });
+        begin = pivot + 1;
     }
     
-    // Extrai elementos do heap
-    for (int i = n - 1; i > 0; i--) {
-        swap(arr[begin], arr[begin + i]);
-        heapify(arr, i, 0, begin);
+    // Folhas: introsort sequencial (heapSort quando a profundidade se esgota)
+    if (begin < end) {
+        introsortUtil(arr, begin, end, depthLimit);
     }
+    pendentes--;
 }
 
-void AlgoritmosOrdenacao::heapify(vector<double>& arr, int n, int i, int begin) {
-    int largest = i;
-    int left = 2 * i + 1;
-    int right = 2 * i + 2;
+// Coloca a mediana de arr[low], arr[mid], arr[high] em arr[high],
+// que é a posição usada como pivô por partition()
+void AlgoritmosOrdenacao::medianOfThree(vector<double>& arr, ptrdiff_t low, ptrdiff_t high) {
+    ptrdiff_t mid = low + (high - low) / 2;
+    
+    if (arr[mid] < arr[low]) swap(arr[mid], arr[low]);
+    if (arr[high] < arr[low]) swap(arr[high], arr[low]);
+    if (arr[mid] < arr[high]) swap(arr[mid], arr[high]);
+}
+
+// Abaixo deste tamanho o Radix Sort usa a variante MSD (recursiva), que
+// não paga as 8 passadas completas do LSD
+static const size_t LIMIAR_RADIX_LSD = 1 << 16;
+
+// Baldes do MSD com até este número de chaves são ordenados por inserção
+static const size_t LIMIAR_RADIX_INSERCAO = 32;
+
+// Radix Sort - função principal
+void AlgoritmosOrdenacao::radixSort(vector<double>& arr) {
+    size_t n = arr.size();
+    if (n <= 1) return;
     
-    if (left < n && arr[begin + left] > arr[begin + largest])
-        largest = left;
+    vector<uint64_t> chaves(n);
+    vector<uint64_t> temp(n);
+    for (size_t i = 0; i < n; i++) {
+        chaves[i] = doubleParaChave(arr[i]);
+    }
     
-    if (right < n && arr[begin + right] > arr[begin + largest])
-        largest = right;
+    if (n >= LIMIAR_RADIX_LSD) {
+        radixSortLSD(chaves, temp);
+    } else {
+        radixSortMSD(chaves.data(), temp.data(), n, 7);
+    }
     
-    if (largest != i) {
-        swap(arr[begin + i], arr[begin + largest]);
-        heapify(arr, n, largest, begin);
+    for (size_t i = 0; i < n; i++) {
+        arr[i] = chaveParaDouble(chaves[i]);
     }
 }
 
-int AlgoritmosOrdenacao::calculateDepthLimit(int n) {
-    return 2 * static_cast<int>(log2(n));
+// Converte o double em um inteiro sem sinal com a mesma ordem:
+// positivos ganham o bit de sinal, negativos têm todos os bits invertidos.
+// NaN tem o sinal zerado para ficar acima de +inf, preservando o payload.
+uint64_t AlgoritmosOrdenacao::doubleParaChave(double valor) {
+    const uint64_t SINAL = 1ULL << 63;
+    uint64_t bits;
+    memcpy(&bits, &valor, sizeof(bits));
+    
+    if (std::isnan(valor)) {
+        bits &= ~SINAL;
+    }
+    return (bits & SINAL) ? ~bits : (bits | SINAL);
 }
 
-// std::sort para comparação
-void AlgoritmosOrdenacao::stdSort(vector<double>& arr) {
-    sort(arr.begin(), arr.end());
-}
\ No newline at end of file
+uint64_t AlgoritmosOrdenacao::chaveCanonica(double valor) {
+    if (std::isnan(valor)) return doubleParaChave(numeric_limits<double>::quiet_NaN());
+    return doubleParaChave(valor == 0.0 ? 0.0 : valor);
+}
+
+double AlgoritmosOrdenacao::chaveParaDouble(uint64_t chave) {
+    const uint64_t SINAL = 1ULL << 63;
+    uint64_t bits = (chave & SINAL) ? (chave & ~SINAL) : ~chave;
+    
+    double valor;
+    memcpy(&valor, &bits, sizeof(valor));
+    return valor;
+}
+
+// LSD: 8 passadas de 8 bits. Todos os histogramas são montados numa única
+// leitura, e passadas em que todas as chaves caem no mesmo balde são puladas
+// (comum em colunas de códigos, cujos bytes altos são constantes)
+void AlgoritmosOrdenacao::radixSortLSD(vector<uint64_t>& chaves, vector<uint64_t>& temp) {
+    size_t n = chaves.size();
+    vector<size_t> histograma(8 * 256, 0);
+    
+    for (size_t i = 0; i < n; i++) {
+        uint64_t chave = chaves[i];
+        for (int b = 0; b < 8; b++) {
+            histograma[b * 256 + ((chave >> (8 * b)) & 0xFF)]++;
+        }
+    }
+    
+    uint64_t* origem = chaves.data();
+    uint64_t* destino = temp.data();
+    
+    for (int b = 0; b < 8; b++) {
+        size_t* contagem = &histograma[b * 256];
+        
+        // Passada trivial: a ordem não muda
+        uint64_t byteQualquer = (origem[0] >> (8 * b)) & 0xFF;
+        if (contagem[byteQualquer] == n) continue;
+        
+        // Contagens -> posições iniciais
+        size_t soma = 0;
+        for (int d = 0; d < 256; d++) {
+            size_t c = contagem[d];
+            contagem[d] = soma;
+            soma += c;
+        }
+        
+        for (size_t i = 0; i < n; i++) {
+            uint64_t chave = origem[i];
+            destino[contagem[(chave >> (8 * b)) & 0xFF]++] = chave;
+        }
+        swap(origem, destino);
+    }
+    
+    if (origem != chaves.data()) {
+        copy(origem, origem + n, chaves.data());
+    }
+}
+
+// MSD: distribui pelo byte mais significativo e ordena cada balde
+// recursivamente pelo byte seguinte; baldes pequenos usam inserção
+void AlgoritmosOrdenacao::radixSortMSD(uint64_t* chaves, uint64_t* temp, size_t n, int byte) {
+    if (n <= LIMIAR_RADIX_INSERCAO) {
+        for (size_t i = 1; i < n; i++) {
+            uint64_t chave = chaves[i];
+            size_t j = i;
+            while (j > 0 && chaves[j - 1] > chave) {
+                chaves[j] = chaves[j - 1];
+                j--;
+            }
+            chaves[j] = chave;
+        }
+        return;
+    }
+    
+    size_t contagem[256];
+    
+    // Pula bytes em que todas as chaves do balde coincidem
+    for (; byte >= 0; byte--) {
+        fill(contagem, contagem + 256, 0);
+        for (size_t i = 0; i < n; i++) {
+            contagem[(chaves[i] >> (8 * byte)) & 0xFF]++;
+        }
+        if (contagem[(chaves[0] >> (8 * byte)) & 0xFF] != n) break;
+    }
+    if (byte < 0) return;
+    
+    size_t inicio[256];
+    size_t soma = 0;
+    for (int d = 0; d < 256; d++) {
+        inicio[d] = soma;
+        soma += contagem[d];
+    }
+    
+    size_t posicao[256];
+    copy(inicio, inicio + 256, posicao);
+    for (size_t i = 0; i < n; i++) {
+        temp[posicao[(chaves[i] >> (8 * byte)) & 0xFF]++] = chaves[i];
+    }
+    copy(temp, temp + n, chaves);
+    
+    if (byte == 0) return;
+    for (int d = 0; d < 256; d++) {
+        if (contagem[d] > 1) {
+            radixSortMSD(chaves + inicio[d], temp + inicio[d], contagem[d], byte - 1);
+        }
+    }
+}
@@ -4,36 +4,125 @@
 #include <vector>
 #include <algorithm>
 #include <cmath>
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+#include <utility>
+#include "contagem_operacoes.h"
 
 using namespace std;
 
+class PoolTarefas;
+
+// Sequências de gaps do Shell Sort (políticas em sequencias_shell.h)
+enum class SequenciaGaps { Shell, Knuth, Sedgewick, Tokuda, Ciura, Pratt };
+
 class AlgoritmosOrdenacao {
 public:
     // Insertion Sort
     static void insertionSort(vector<double>& arr);
     
-    // Shell Sort
+    // Shell Sort (sequência original n/2, n/4, ..., 1)
     static void shellSort(vector<double>& arr);
     
+    // Shell Sort com outra sequência de gaps (uma instância por sequência)
+    static void shellSort(vector<double>& arr, SequenciaGaps sequencia);
+    static void shellSort(vector<double>& arr, SequenciaGaps sequencia, ContagemOperacoes& contagem);
+    
     // Quick Sort
-    static void quickSort(vector<double>& arr, int low, int high);
+    static void quickSort(vector<double>& arr, ptrdiff_t low, ptrdiff_t high);
     static void quickSort(vector<double>& arr);
     
     // Introsort (implementação manual)
+    // As sobrecargas inteiras permitem comparar double x int64 x int32
     static void introsort(vector<double>& arr);
+    static void introsort(vector<int64_t>& arr);
+    static void introsort(vector<int32_t>& arr);
+    
+    // Mesmos núcleos instanciados com a política de contagem (comparações,
+    // movimentos, trocas, profundidade e fallbacks do introsort); as
+    // versões sem contagem não pagam nada por isso
+    static void insertionSort(vector<double>& arr, ContagemOperacoes& contagem);
+    static void shellSort(vector<double>& arr, ContagemOperacoes& contagem);
+    static void quickSort(vector<double>& arr, ContagemOperacoes& contagem);
+    static void introsort(vector<double>& arr, ContagemOperacoes& contagem);
+    
+    // Pattern-defeating quicksort: pivô ninther, partição em blocos sem
+    // desvios e detecção de entradas ordenadas/repetidas
+    static void pdqSort(vector<double>& arr);
+    
+    // Powersort: merge sort estável e adaptativo (runs naturais + galope)
+    static void powerSort(vector<double>& arr);
+    
+    // Merge Sort estável bottom-up com buffer da arena da thread (sem
+    // alocação por chamada depois da primeira ordenação de cada tamanho)
+    static void mergeSort(vector<double>& arr);
+    
+    // std::stable_sort (referência para as ordenações estáveis)
+    static void stableSort(vector<double>& arr);
+    
+    // Reordenação incremental de uma coluna já ordenada:
+    // - arr[0, tamanhoOrdenado) ordenado e o resto um lote acrescentado
+    // - ou valores alterados nas posições dadas
+    static void reordenarIncremental(vector<double>& arr, size_t tamanhoOrdenado);
+    static void atualizarOrdenado(vector<double>& arr,
+                                  const vector<pair<size_t, double>>& alteracoes);
+    
+    // Seleção parcial (k limitado ao tamanho do array):
+    // - partialSort: os k menores ordenados em arr[0, k), resto sem ordem
+    // - nthElement: arr[k] fica com o valor da posição k do array ordenado,
+    //   sem maiores antes nem menores depois (introselect)
+    static void partialSort(vector<double>& arr, size_t k);
+    static void nthElement(vector<double>& arr, size_t k);
+    
+    // Introsort com partição vetorial e rede de ordenação nas folhas (AVX2)
+    static void introsortSIMD(vector<double>& arr);
+    
+    // Ordenação de arrays pequenos (até 16 elementos) por rede de ordenação
+    static void sortSmall(double* dados, size_t n);
     
     // std::sort (para comparação)
     static void stdSort(vector<double>& arr);
+    
+    // std::sort com política de execução paralela (std::execution::par)
+    static void stdSortParallel(vector<double>& arr);
+    
+    // Introsort paralelo (fork-join sobre pool com roubo de tarefas)
+    // numThreads = 0 usa todos os núcleos disponíveis
+    static void parallelSort(vector<double>& arr, unsigned numThreads = 0);
+    
+    // Radix Sort sobre o padrão de bits IEEE-754 (não comparativo)
+    // Negativos e -0.0 ficam antes de +0.0; NaN vai para o final
+    static void radixSort(vector<double>& arr);
+    
+    // Mapeamento double <-> inteiro sem sinal que preserva a ordem
+    // (usado pelo Radix Sort e pelo empacotamento de chaves compostas)
+    static uint64_t doubleParaChave(double valor);
+    static double chaveParaDouble(uint64_t chave);
+    
+    // Chave de comparação (não reversível): -0.0 igual a +0.0 e todo NaN
+    // numa mesma chave acima de +inf. Ordenações que devolvem permutação
+    // comparam por ela para concordarem entre si.
+    static uint64_t chaveCanonica(double valor);
 
 private:
     // Funções auxiliares para Quick Sort
-    static int partition(vector<double>& arr, int low, int high);
+    static ptrdiff_t partition(vector<double>& arr, ptrdiff_t low, ptrdiff_t high);
     
     // Funções auxiliares para Introsort
-    static void introsortUtil(vector<double>& arr, int begin, int end, int depthLimit);
-    static void heapSort(vector<double>& arr, int begin, int end);
-    static void heapify(vector<double>& arr, int n, int i, int begin);
-    static int calculateDepthLimit(int n);
+    static void introsortUtil(vector<double>& arr, ptrdiff_t begin, ptrdiff_t end, int depthLimit);
+    static void heapSort(vector<double>& arr, ptrdiff_t begin, ptrdiff_t end);
+    static int calculateDepthLimit(ptrdiff_t n);
+    static void introsortSIMDUtil(vector<double>& arr, ptrdiff_t begin, ptrdiff_t end, int depthLimit);
+    
+    // Funções auxiliares para o Introsort paralelo
+    static void parallelSortUtil(vector<double>& arr, ptrdiff_t begin, ptrdiff_t end, int depthLimit,
+                                 PoolTarefas& pool, atomic<size_t>& pendentes);
+    static void medianOfThree(vector<double>& arr, ptrdiff_t low, ptrdiff_t high);
+    
+    // Funções auxiliares para Radix Sort
+    static void radixSortLSD(vector<uint64_t>& chaves, vector<uint64_t>& temp);
+    static void radixSortMSD(uint64_t* chaves, uint64_t* temp, size_t n, int byte);
 };
 
 #endif
\ No newline at end of file
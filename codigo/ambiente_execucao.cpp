@@ -0,0 +1,138 @@
+#include "ambiente_execucao.h"
+#include "despacho_ordenacao.h"
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <thread>
+
+#ifdef __linux__
+#include <sys/utsname.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+// Definidos pelo Makefile para este objeto; compilado à mão fica sem eles
+#ifndef FLAGS_COMPILACAO
+#define FLAGS_COMPILACAO "desconhecido"
+#endif
+#ifndef COMMIT_BUILD
+#define COMMIT_BUILD "desconhecido"
+#endif
+
+namespace {
+
+const string DESCONHECIDO = "desconhecido";
+
+// Primeira linha de um arquivo (sysfs/procfs); vazio se não existir
+string lerLinha(const string& caminho) {
+    ifstream arquivo(caminho);
+    string linha;
+    getline(arquivo, linha);
+    return linha;
+}
+
+string ouDesconhecido(const string& valor) {
+    return valor.empty() ? DESCONHECIDO : valor;
+}
+
+string lerModeloCpu() {
+    ifstream cpuinfo("/proc/cpuinfo");
+    string linha;
+    while (getline(cpuinfo, linha)) {
+        // x86: "model name"; ARM: "Model" ou "CPU part" quando não há nome
+        if (linha.rfind("model name", 0) == 0 || linha.rfind("Model", 0) == 0) {
+            size_t separador = linha.find(':');
+            if (separador == string::npos) continue;
+            size_t inicio = linha.find_first_not_of(' ', separador + 1);
+            return inicio == string::npos ? "" : linha.substr(inicio);
+        }
+    }
+    return "";
+}
+
+// intel_pstate expõe no_turbo; acpi-cpufreq (AMD e outros) expõe boost
+string lerTurbo() {
+    string semTurbo = lerLinha("/sys/devices/system/cpu/intel_pstate/no_turbo");
+    if (!semTurbo.empty()) return semTurbo == "0" ? "ativo" : "desativado";
+    string boost = lerLinha("/sys/devices/system/cpu/cpufreq/boost");
+    if (!boost.empty()) return boost == "1" ? "ativo" : "desativado";
+    return DESCONHECIDO;
+}
+
+string dataAtual() {
+    time_t agora = time(nullptr);
+    tm local;
+    localtime_r(&agora, &local);
+    char texto[32];
+    strftime(texto, sizeof(texto), "%Y-%m-%dT%H:%M:%S%z", &local);
+    return texto;
+}
+
+}
+
+AmbienteExecucao AmbienteExecucao::capturar() {
+    AmbienteExecucao ambiente;
+
+#if defined(__clang__)
+    ambiente.compilador = "clang " __clang_version__;
+#elif defined(__GNUC__)
+    ambiente.compilador = "g++ " __VERSION__;
+#else
+    ambiente.compilador = DESCONHECIDO;
+#endif
+    ambiente.padraoCpp = to_string(__cplusplus);
+    ambiente.flagsCompilacao = FLAGS_COMPILACAO;
+    ambiente.commit = ouDesconhecido(COMMIT_BUILD);
+    ambiente.dataCompilacao = string(__DATE__) + " " + __TIME__;
+
+    ambiente.modeloCpu = ouDesconhecido(lerModeloCpu());
+    ambiente.nucleos = static_cast<int>(thread::hardware_concurrency());
+    const string cpufreq = "/sys/devices/system/cpu/cpu0/cpufreq/";
+    ambiente.governador = ouDesconhecido(lerLinha(cpufreq + "scaling_governor"));
+    // Conteúdo não numérico fica "desconhecido" em vez de lançar
+    string maximaKhz = lerLinha(cpufreq + "cpuinfo_max_freq");
+    char* fimNumero = nullptr;
+    long khz = strtol(maximaKhz.c_str(), &fimNumero, 10);
+    bool numerico = !maximaKhz.empty() && fimNumero != maximaKhz.c_str() && *fimNumero == '\0';
+    ambiente.frequenciaMaximaMhz = numerico ? to_string(khz / 1000) : DESCONHECIDO;
+    ambiente.turbo = lerTurbo();
+
+#ifdef __linux__
+    utsname nome;
+    if (uname(&nome) == 0) {
+        ambiente.sistema = string(nome.sysname) + " " + nome.release + " " + nome.machine;
+        ambiente.hostname = nome.nodename;
+    }
+#endif
+    ambiente.sistema = ouDesconhecido(ambiente.sistema);
+    ambiente.hostname = ouDesconhecido(ambiente.hostname);
+    ambiente.dataExecucao = dataAtual();
+    ambiente.despacho = DespachoOrdenacao::descricao();
+    return ambiente;
+}
+
+vector<pair<string, string>> AmbienteExecucao::campos() const {
+    return {
+        {"compilador", compilador},
+        {"padrao_cpp", padraoCpp},
+        {"flags", flagsCompilacao},
+        {"commit", commit},
+        {"data_compilacao", dataCompilacao},
+        {"cpu", modeloCpu},
+        {"nucleos", to_string(nucleos)},
+        {"governador", governador},
+        {"frequencia_maxima_mhz", frequenciaMaximaMhz},
+        {"turbo", turbo},
+        {"sistema", sistema},
+        {"hostname", hostname},
+        {"data_execucao", dataExecucao},
+        {"despacho", despacho},
+    };
+}
+
+const vector<string>& AmbienteExecucao::chavesComparaveis() {
+    static const vector<string> chaves = {"compilador", "flags", "cpu", "governador", "turbo",
+                                           "despacho"};
+    return chaves;
+}
@@ -0,0 +1,44 @@
+#ifndef AMBIENTE_EXECUCAO_H
+#define AMBIENTE_EXECUCAO_H
+
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+// Procedência de uma execução: como o binário foi compilado (compilador,
+// flags e commit, gravados pelo Makefile) e onde está rodando (CPU,
+// governador de frequência, kernel). Campo que não pôde ser lido fica
+// "desconhecido".
+struct AmbienteExecucao {
+    // Compilação
+    string compilador;
+    string padraoCpp;
+    string flagsCompilacao;
+    string commit;              // git describe --always --dirty no build
+    string dataCompilacao;
+
+    // Máquina
+    string modeloCpu;
+    int nucleos = 0;
+    string governador;          // cpufreq da CPU 0
+    string frequenciaMaximaMhz;
+    string turbo;               // "ativo", "desativado" ou "desconhecido"
+    string sistema;             // uname: sistema, versão do kernel, arquitetura
+    string hostname;
+    string dataExecucao;        // ISO 8601, hora local
+
+    // Núcleo, limiares e faixas da ordenação despachada em vigor
+    string despacho;
+
+    static AmbienteExecucao capturar();
+
+    // Pares chave/valor na ordem em que são gravados (CSV e JSON)
+    vector<pair<string, string>> campos() const;
+
+    // Chaves cuja diferença invalida a comparação de tempos entre execuções
+    static const vector<string>& chavesComparaveis();
+};
+
+#endif
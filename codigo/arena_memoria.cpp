@@ -0,0 +1,80 @@
+#include "arena_memoria.h"
+#include <algorithm>
+#include <new>
+
+using namespace std;
+
+namespace {
+
+// Menor bloco pedido ao sistema
+const size_t BLOCO_INICIAL = 64 * 1024;
+
+}
+
+ArenaMemoria::ArenaMemoria(size_t capacidadeInicial) {
+    if (capacidadeInicial > 0) adicionarBloco(capacidadeInicial);
+}
+
+ArenaMemoria::~ArenaMemoria() {
+    for (Bloco& bloco : blocos) ::operator delete(bloco.dados);
+}
+
+void* ArenaMemoria::alocar(size_t bytes, size_t alinhamento) {
+    if (blocos.empty()) adicionarBloco(max(BLOCO_INICIAL, bytes + alinhamento));
+
+    while (true) {
+        Bloco& bloco = blocos[blocoAtual];
+        uintptr_t base = reinterpret_cast<uintptr_t>(bloco.dados);
+        uintptr_t inicio = (base + deslocamento + alinhamento - 1) & ~(uintptr_t(alinhamento) - 1);
+        size_t fim = (inicio - base) + bytes;
+
+        if (fim <= bloco.tamanho) {
+            deslocamento = fim;
+            return reinterpret_cast<void*>(inicio);
+        }
+
+        // Não coube: próximo bloco já existente ou um novo com o dobro da
+        // capacidade total (o crescimento geométrico limita as alocações)
+        if (blocoAtual + 1 == blocos.size()) {
+            adicionarBloco(max(bytes + alinhamento, 2 * capacidade()));
+        }
+        blocoAtual++;
+        deslocamento = 0;
+    }
+}
+
+size_t ArenaMemoria::capacidade() const {
+    size_t total = 0;
+    for (const Bloco& bloco : blocos) total += bloco.tamanho;
+    return total;
+}
+
+size_t ArenaMemoria::emUso() const {
+    size_t total = deslocamento;
+    for (size_t i = 0; i < blocoAtual; i++) total += blocos[i].tamanho;
+    return total;
+}
+
+ArenaMemoria& ArenaMemoria::daThread() {
+    thread_local ArenaMemoria arena;
+    return arena;
+}
+
+void ArenaMemoria::adicionarBloco(size_t tamanho) {
+    blocos.push_back({static_cast<char*>(::operator new(tamanho)), tamanho});
+    totalAlocacoesSistema++;
+}
+
+void ArenaMemoria::restaurar(size_t bloco, size_t novoDeslocamento) {
+    blocoAtual = bloco;
+    deslocamento = novoDeslocamento;
+
+    // Arena vazia com vários blocos: troca todos por um único do tamanho
+    // total, para que o próximo pedido do mesmo tamanho caiba sem crescer
+    if (blocoAtual == 0 && deslocamento == 0 && blocos.size() > 1) {
+        size_t total = capacidade();
+        for (Bloco& existente : blocos) ::operator delete(existente.dados);
+        blocos.clear();
+        adicionarBloco(total);
+    }
+}
@@ -0,0 +1,72 @@
+#ifndef ARENA_MEMORIA_H
+#define ARENA_MEMORIA_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+using namespace std;
+
+// Arena de memória reutilizável para buffers temporários das ordenações.
+// Alocar é só avançar um deslocamento; a memória volta à arena quando o
+// Escopo que a reservou termina. A arena só pede memória ao sistema
+// quando um pedido não cabe no que já tem, então depois da primeira
+// ordenação de um tamanho as seguintes não alocam nada no heap.
+class ArenaMemoria {
+public:
+    explicit ArenaMemoria(size_t capacidadeInicial = 0);
+    ~ArenaMemoria();
+
+    ArenaMemoria(const ArenaMemoria&) = delete;
+    ArenaMemoria& operator=(const ArenaMemoria&) = delete;
+
+    // Memória não inicializada, válida até o fim do Escopo corrente
+    void* alocar(size_t bytes, size_t alinhamento = alignof(max_align_t));
+
+    template <class T>
+    T* alocar(size_t n) {
+        return static_cast<T*>(alocar(n * sizeof(T), alignof(T)));
+    }
+
+    // Devolve à arena tudo o que foi alocado durante a sua vida
+    class Escopo {
+    public:
+        explicit Escopo(ArenaMemoria& arena)
+            : arena(arena), bloco(arena.blocoAtual), deslocamento(arena.deslocamento) {}
+        ~Escopo() { arena.restaurar(bloco, deslocamento); }
+
+        Escopo(const Escopo&) = delete;
+        Escopo& operator=(const Escopo&) = delete;
+
+    private:
+        ArenaMemoria& arena;
+        size_t bloco;
+        size_t deslocamento;
+    };
+
+    size_t capacidade() const;
+    size_t emUso() const;
+
+    // Quantas vezes a arena pediu memória ao sistema (não cresce quando
+    // os buffers são reaproveitados)
+    uint64_t alocacoesSistema() const { return totalAlocacoesSistema; }
+
+    // Arena própria de cada thread, mantida entre chamadas
+    static ArenaMemoria& daThread();
+
+private:
+    struct Bloco {
+        char* dados;
+        size_t tamanho;
+    };
+
+    vector<Bloco> blocos;
+    size_t blocoAtual = 0;
+    size_t deslocamento = 0;
+    uint64_t totalAlocacoesSistema = 0;
+
+    void adicionarBloco(size_t tamanho);
+    void restaurar(size_t bloco, size_t deslocamento);
+};
+
+#endif
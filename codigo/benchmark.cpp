@@ -1,29 +1,212 @@
 #include "benchmark.h"
 #include "algoritmos_ordenacao.h"
+#include "ordenacao_externa.h"
+#include "gerador_distribuicoes.h"
+#include "ordenacao_generica.h"
+#include "ambiente_execucao.h"
+#include "ordenacao_texto.h"
+#include "ordenacao_celulas.h"
+#include "ordenacao_indireta.h"
+#include "despacho_ordenacao.h"
 #include <iostream>
 #include <fstream>
 #include <iomanip>
 #include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <map>
+#include <random>
+#include <sstream>
+#include <thread>
+#include <sched.h>
+#include <csignal>
+#include <cerrno>
+#include <poll.h>
+#include <sys/wait.h>
+#include <unistd.h>
 
 using namespace std;
 
-ResultadoBenchmark Benchmark::medirTempo(const string& nome, vector<double> dados, 
-                                        function<void(vector<double>&)> algoritmo) {
+ConfiguracaoMedicao Benchmark::configuracao;
+
+void Benchmark::configurarMedicao(const ConfiguracaoMedicao& novaConfiguracao) {
+    configuracao = novaConfiguracao;
+    configuracao.repeticoes = max(1, configuracao.repeticoes);
+    configuracao.aquecimento = max(0, configuracao.aquecimento);
+    
+    if (configuracao.cpuFixa >= 0) {
+        cpu_set_t conjunto;
+        CPU_ZERO(&conjunto);
+        CPU_SET(configuracao.cpuFixa, &conjunto);
+        if (sched_setaffinity(0, sizeof(conjunto), &conjunto) != 0) {
+            cerr << "Aviso: não foi possível fixar o processo na CPU "
+                 << configuracao.cpuFixa << endl;
+        }
+    }
+}
+
+const ConfiguracaoMedicao& Benchmark::configuracaoMedicao() {
+    return configuracao;
+}
+
+template <class Preparar, class Executar>
+vector<double> Benchmark::coletarAmostras(Preparar preparar, Executar executar,
+                                          LeituraContadores* contadores,
+                                          LeituraAlocacoes* alocacoes) {
+    vector<double> amostras;
+    amostras.reserve(configuracao.repeticoes);
+    
+    // Os descritores são abertos uma vez; ligar e desligar os contadores
+    // fica fora da região cronometrada
+    bool usarContadores = contadores && configuracao.contadoresHardware;
+    ContadoresHardware hardware;
+    usarContadores = usarContadores && hardware.disponivel();
+    
+    for (int i = 0; i < configuracao.aquecimento + configuracao.repeticoes; i++) {
+        preparar();
+        
+        if (alocacoes) ContadorAlocacoes::iniciar();
+        if (usarContadores) hardware.iniciar();
+        auto inicio = steady_clock::now();
+        executar();
+        auto fim = steady_clock::now();
+        LeituraContadores leitura = usarContadores ? hardware.parar() : LeituraContadores();
+        LeituraAlocacoes memoria = alocacoes ? ContadorAlocacoes::parar() : LeituraAlocacoes();
+        
+        if (i >= configuracao.aquecimento) {
+            amostras.push_back(duration<double, milli>(fim - inicio).count());
+            if (usarContadores) contadores->somar(leitura);
+            if (alocacoes) alocacoes->somar(memoria);
+        }
+    }
+    
+    if (usarContadores) contadores->dividir(amostras.size());
+    if (alocacoes) alocacoes->dividir(amostras.size());
+    return amostras;
+}
+
+// Percentil com interpolação linear sobre amostras já ordenadas
+static double percentil(const vector<double>& ordenadas, double p) {
+    double posicao = p * (ordenadas.size() - 1);
+    size_t base = static_cast<size_t>(posicao);
+    if (base + 1 >= ordenadas.size()) return ordenadas.back();
+    return ordenadas[base] + (posicao - base) * (ordenadas[base + 1] - ordenadas[base]);
+}
+
+void Benchmark::resumirAmostras(vector<double> amostras, ResultadoBenchmark& resultado) {
+    if (amostras.empty()) return;
+    sort(amostras.begin(), amostras.end());
+    size_t totalAmostras = amostras.size();
+    
+    // Com poucas amostras os quartis não dizem nada; a partir de 4, descarta
+    // o que cair fora de [Q1 - 1.5 IQR, Q3 + 1.5 IQR]
+    if (configuracao.removerOutliers && amostras.size() >= 4) {
+        double q1 = percentil(amostras, 0.25);
+        double q3 = percentil(amostras, 0.75);
+        double iqr = q3 - q1;
+        auto primeiro = lower_bound(amostras.begin(), amostras.end(), q1 - 1.5 * iqr);
+        auto ultimo = upper_bound(amostras.begin(), amostras.end(), q3 + 1.5 * iqr);
+        amostras = vector<double>(primeiro, ultimo);
+    }
+    
+    size_t n = amostras.size();
+    resultado.repeticoes = static_cast<int>(totalAmostras);
+    resultado.outliersRemovidos = static_cast<int>(totalAmostras - n);
+    resultado.minimoMs = amostras.front();
+    resultado.medianaMs = percentil(amostras, 0.5);
+    resultado.p95Ms = percentil(amostras, 0.95);
+    
+    double soma = 0;
+    for (double amostra : amostras) soma += amostra;
+    resultado.mediaMs = soma / n;
+    
+    double somaQuadrados = 0;
+    for (double amostra : amostras) {
+        somaQuadrados += (amostra - resultado.mediaMs) * (amostra - resultado.mediaMs);
+    }
+    resultado.desvioPadraoMs = n > 1 ? sqrt(somaQuadrados / (n - 1)) : 0;
+    
+    // IC da mediana por bootstrap percentil; semente fixa para que a mesma
+    // execução gere o mesmo intervalo
+    resultado.icInferiorMs = resultado.icSuperiorMs = resultado.medianaMs;
+    if (n > 1 && configuracao.reamostragensBootstrap > 0) {
+        mt19937 gerador(42);
+        uniform_int_distribution<size_t> indice(0, n - 1);
+        vector<double> medianas(configuracao.reamostragensBootstrap);
+        vector<double> reamostra(n);
+        
+        for (double& mediana : medianas) {
+            for (double& valor : reamostra) valor = amostras[indice(gerador)];
+            sort(reamostra.begin(), reamostra.end());
+            mediana = percentil(reamostra, 0.5);
+        }
+        sort(medianas.begin(), medianas.end());
+        
+        double alfa = 1.0 - configuracao.nivelConfianca;
+        resultado.icInferiorMs = percentil(medianas, alfa / 2);
+        resultado.icSuperiorMs = percentil(medianas, 1.0 - alfa / 2);
+    }
+    
+    resultado.tempoMs = resultado.medianaMs;
+}
+
+template <class T, class Algoritmo, class Verificador>
+ResultadoBenchmark Benchmark::medirTempoVerificado(const string& nome, const vector<T>& dados,
+                                                  Algoritmo algoritmo, Verificador verificador) {
     ResultadoBenchmark resultado;
     resultado.nomeAlgoritmo = nome;
     resultado.tamanhoArray = dados.size();
     resultado.sucesso = false;
     
     try {
-        auto inicio = high_resolution_clock::now();
-        algoritmo(dados);
-        auto fim = high_resolution_clock::now();
+        // A cópia reaproveita a capacidade de 'trabalho', sem alocar por repetição
+        vector<T> trabalho;
+        trabalho.reserve(dados.size());
+        bool correto = true;
+        bool executou = false;
+        
+        vector<double> amostras = coletarAmostras(
+            [&]() {
+                if (executou) correto = correto && verificador(trabalho);
+                trabalho.assign(dados.begin(), dados.end());
+            },
+            [&]() {
+                algoritmo(trabalho);
+                executou = true;
+            },
+            &resultado.contadores, &resultado.alocacoes);
         
-        auto duracao = duration_cast<microseconds>(fim - inicio);
-        resultado.tempoMs = duracao.count() / 1000.0; // Converte para milissegundos
+        resultado.sucesso = correto && verificador(trabalho);
+        resumirAmostras(move(amostras), resultado);
         
-        // Verifica se a ordenação foi bem-sucedida
-        resultado.sucesso = verificarOrdenacao(dados);
+        if (!resultado.sucesso) {
+            cerr << "ERRO: " << nome << " não ordenou corretamente!" << endl;
+        }
+        
+    } catch (const exception& e) {
+        cerr << "Erro durante execução de " << nome << ": " << e.what() << endl;
+        resultado.tempoMs = -1;
+    }
+    
+    return resultado;
+}
+
+template <class Preparar, class Executar, class Verificar>
+ResultadoBenchmark Benchmark::medirRegiao(const string& nome, size_t tamanho, Preparar preparar,
+                                         Executar executar, Verificar verificar) {
+    ResultadoBenchmark resultado;
+    resultado.nomeAlgoritmo = nome;
+    resultado.tamanhoArray = tamanho;
+    resultado.sucesso = false;
+    
+    try {
+        resumirAmostras(coletarAmostras(preparar, executar, &resultado.contadores,
+                                        &resultado.alocacoes),
+                        resultado);
+        resultado.sucesso = verificar();
         
         if (!resultado.sucesso) {
             cerr << "ERRO: " << nome << " não ordenou corretamente!" << endl;
@@ -37,38 +220,1013 @@ ResultadoBenchmark Benchmark::medirTempo(const string& nome, vector<double> dado
     return resultado;
 }
 
+template <class T, class Algoritmo>
+ResultadoBenchmark Benchmark::medirTempoTipado(const string& nome, const vector<T>& dados,
+                                              Algoritmo algoritmo) {
+    return medirTempoVerificado(nome, dados, algoritmo, [](const vector<T>& arr) {
+        return is_sorted(arr.begin(), arr.end());
+    });
+}
+
+ResultadoBenchmark Benchmark::medirTempo(const string& nome, const vector<double>& dados, 
+                                        function<void(vector<double>&)> algoritmo) {
+    return medirTempoTipado(nome, dados, algoritmo);
+}
+
+const vector<AlgoritmoRegistrado>& Benchmark::algoritmosRegistrados() {
+    static const vector<AlgoritmoRegistrado> algoritmos = {
+        {"Insertion Sort", [](vector<double>& arr) { AlgoritmosOrdenacao::insertionSort(arr); },
+         [](vector<double>& arr, ContagemOperacoes& c) { AlgoritmosOrdenacao::insertionSort(arr, c); }},
+        {"Shell Sort", [](vector<double>& arr) { AlgoritmosOrdenacao::shellSort(arr); },
+         [](vector<double>& arr, ContagemOperacoes& c) { AlgoritmosOrdenacao::shellSort(arr, c); }},
+        // Shell Sort com as outras sequências de gaps
+        {"Shell Sort (Knuth)",
+         [](vector<double>& arr) { AlgoritmosOrdenacao::shellSort(arr, SequenciaGaps::Knuth); },
+         [](vector<double>& arr, ContagemOperacoes& c) {
+             AlgoritmosOrdenacao::shellSort(arr, SequenciaGaps::Knuth, c);
+         }},
+        {"Shell Sort (Sedgewick)",
+         [](vector<double>& arr) { AlgoritmosOrdenacao::shellSort(arr, SequenciaGaps::Sedgewick); },
+         [](vector<double>& arr, ContagemOperacoes& c) {
+             AlgoritmosOrdenacao::shellSort(arr, SequenciaGaps::Sedgewick, c);
+         }},
+        {"Shell Sort (Tokuda)",
+         [](vector<double>& arr) { AlgoritmosOrdenacao::shellSort(arr, SequenciaGaps::Tokuda); },
+         [](vector<double>& arr, ContagemOperacoes& c) {
+             AlgoritmosOrdenacao::shellSort(arr, SequenciaGaps::Tokuda, c);
+         }},
+        {"Shell Sort (Ciura)",
+         [](vector<double>& arr) { AlgoritmosOrdenacao::shellSort(arr, SequenciaGaps::Ciura); },
+         [](vector<double>& arr, ContagemOperacoes& c) {
+             AlgoritmosOrdenacao::shellSort(arr, SequenciaGaps::Ciura, c);
+         }},
+        {"Shell Sort (Pratt)",
+         [](vector<double>& arr) { AlgoritmosOrdenacao::shellSort(arr, SequenciaGaps::Pratt); },
+         [](vector<double>& arr, ContagemOperacoes& c) {
+             AlgoritmosOrdenacao::shellSort(arr, SequenciaGaps::Pratt, c);
+         }},
+        {"Quick Sort", [](vector<double>& arr) { AlgoritmosOrdenacao::quickSort(arr); },
+         [](vector<double>& arr, ContagemOperacoes& c) { AlgoritmosOrdenacao::quickSort(arr, c); }},
+        {"Introsort (manual)", [](vector<double>& arr) { AlgoritmosOrdenacao::introsort(arr); },
+         [](vector<double>& arr, ContagemOperacoes& c) { AlgoritmosOrdenacao::introsort(arr, c); }},
+        // Pattern-defeating quicksort
+        {"PDQ Sort", [](vector<double>& arr) { AlgoritmosOrdenacao::pdqSort(arr); }},
+        // Merge sort adaptativo (runs naturais)
+        {"Power Sort", [](vector<double>& arr) { AlgoritmosOrdenacao::powerSort(arr); }},
+        // Ordenações estáveis (como a do Calc)
+        {"Merge Sort (arena)", [](vector<double>& arr) { AlgoritmosOrdenacao::mergeSort(arr); }},
+        {"std::stable_sort", [](vector<double>& arr) { AlgoritmosOrdenacao::stableSort(arr); }},
+        // Introsort vetorizado (AVX2, fallback escalar)
+        {"Introsort (SIMD)", [](vector<double>& arr) { AlgoritmosOrdenacao::introsortSIMD(arr); }},
+        {"std::sort", [](vector<double>& arr) { AlgoritmosOrdenacao::stdSort(arr); }},
+        {"std::sort (par)", [](vector<double>& arr) { AlgoritmosOrdenacao::stdSortParallel(arr); }},
+        // Introsort paralelo
+        {"Parallel Sort", [](vector<double>& arr) { AlgoritmosOrdenacao::parallelSort(arr); }},
+        {"Radix Sort", [](vector<double>& arr) { AlgoritmosOrdenacao::radixSort(arr); }},
+        // Limiares e variante de instruções do arquivo de ajuste (--autoajuste)
+        {"Introsort (ajustado)", [](vector<double>& arr) { DespachoOrdenacao::introsort(arr); }},
+        {"Ordenação despachada", [](vector<double>& arr) { DespachoOrdenacao::ordenar(arr); }}};
+    return algoritmos;
+}
+
+static bool selecionado(const vector<string>& selecionados, const string& nome) {
+    return selecionados.empty() ||
+           find(selecionados.begin(), selecionados.end(), nome) != selecionados.end();
+}
+
+ResultadoBenchmark Benchmark::medirAlgoritmo(const AlgoritmoRegistrado& algoritmo,
+                                            const vector<double>& dados) {
+    ResultadoBenchmark resultado = medirTempo(algoritmo.nome, dados, algoritmo.ordenar);
+    
+    if (algoritmo.contar) {
+        vector<double> copia(dados);
+        algoritmo.contar(copia, resultado.operacoes);
+        resultado.operacoesContadas = true;
+    }
+    return resultado;
+}
+
+namespace {
+
+// Campos numéricos de ResultadoBenchmark, copiados byte a byte pelo pipe
+struct ResultadoSerializado {
+    double tempoMs;
+    bool sucesso;
+    int repeticoes;
+    int outliersRemovidos;
+    double minimoMs, medianaMs, mediaMs, desvioPadraoMs, p95Ms, icInferiorMs, icSuperiorMs;
+    LeituraContadores contadores;
+    LeituraAlocacoes alocacoes;
+    ContagemOperacoes operacoes;
+    bool operacoesContadas;
+};
+
+}
+
+bool Benchmark::medirEmProcessoFilho(const AlgoritmoRegistrado& algoritmo,
+                                     const vector<double>& dados, double limiteMs,
+                                     ResultadoBenchmark& resultado) {
+    int canal[2];
+    if (pipe(canal) != 0) {
+        cerr << "Erro ao criar pipe para o processo filho" << endl;
+        return false;
+    }
+    
+    // Sem isso o buffer ainda não descarregado sairia duas vezes
+    cout.flush();
+    cerr.flush();
+    
+    pid_t filho = fork();
+    if (filho < 0) {
+        cerr << "Erro ao criar processo filho" << endl;
+        close(canal[0]);
+        close(canal[1]);
+        return false;
+    }
+    
+    if (filho == 0) {
+        close(canal[0]);
+        ResultadoBenchmark medido = medirAlgoritmo(algoritmo, dados);
+        ResultadoSerializado serializado = {
+            medido.tempoMs, medido.sucesso, medido.repeticoes, medido.outliersRemovidos,
+            medido.minimoMs, medido.medianaMs, medido.mediaMs, medido.desvioPadraoMs,
+            medido.p95Ms, medido.icInferiorMs, medido.icSuperiorMs, medido.contadores,
+            medido.alocacoes, medido.operacoes, medido.operacoesContadas};
+        bool escrito = write(canal[1], &serializado, sizeof(serializado)) ==
+                       static_cast<ssize_t>(sizeof(serializado));
+        cout.flush();
+        _exit(escrito ? 0 : 1);
+    }
+    
+    // Vigia: espera o resultado até o prazo e mata o filho se passar
+    close(canal[1]);
+    ResultadoSerializado serializado;
+    char* destino = reinterpret_cast<char*>(&serializado);
+    size_t recebidos = 0;
+    auto prazo = steady_clock::now() + duration<double, milli>(limiteMs);
+    
+    while (recebidos < sizeof(serializado)) {
+        double restanteMs = duration<double, milli>(prazo - steady_clock::now()).count();
+        if (restanteMs <= 0) break;
+        
+        pollfd leitura = {canal[0], POLLIN, 0};
+        int pronto = poll(&leitura, 1, static_cast<int>(min(restanteMs, 1000.0)) + 1);
+        if (pronto < 0 && errno != EINTR) break;
+        if (pronto <= 0) continue;
+        
+        ssize_t lidos = read(canal[0], destino + recebidos, sizeof(serializado) - recebidos);
+        if (lidos <= 0) break;
+        recebidos += lidos;
+    }
+    close(canal[0]);
+    
+    bool completo = recebidos == sizeof(serializado);
+    if (!completo) kill(filho, SIGKILL);
+    int estado = 0;
+    waitpid(filho, &estado, 0);
+    if (!completo) return false;
+    
+    resultado.nomeAlgoritmo = algoritmo.nome;
+    resultado.tamanhoArray = dados.size();
+    resultado.tempoMs = serializado.tempoMs;
+    resultado.sucesso = serializado.sucesso;
+    resultado.repeticoes = serializado.repeticoes;
+    resultado.outliersRemovidos = serializado.outliersRemovidos;
+    resultado.minimoMs = serializado.minimoMs;
+    resultado.medianaMs = serializado.medianaMs;
+    resultado.mediaMs = serializado.mediaMs;
+    resultado.desvioPadraoMs = serializado.desvioPadraoMs;
+    resultado.p95Ms = serializado.p95Ms;
+    resultado.icInferiorMs = serializado.icInferiorMs;
+    resultado.icSuperiorMs = serializado.icSuperiorMs;
+    resultado.contadores = serializado.contadores;
+    resultado.alocacoes = serializado.alocacoes;
+    resultado.operacoes = serializado.operacoes;
+    resultado.operacoesContadas = serializado.operacoesContadas;
+    return true;
+}
+
+double Benchmark::extrapolarTempo(const vector<pair<double, double>>& pontos, double n) {
+    if (pontos.empty()) return -1;
+    
+    double expoente = 1.0;
+    double somaX = 0, somaY = 0, somaXX = 0, somaXY = 0;
+    for (const auto& ponto : pontos) {
+        double x = log(ponto.first), y = log(max(ponto.second, 1e-6));
+        somaX += x;
+        somaY += y;
+        somaXX += x * x;
+        somaXY += x * y;
+    }
+    double k = pontos.size();
+    double denominador = k * somaXX - somaX * somaX;
+    if (pontos.size() >= 2 && denominador > 0) {
+        expoente = (k * somaXY - somaX * somaY) / denominador;
+    }
+    
+    // Nenhuma ordenação por comparação cresce menos que n; ruído em
+    // tamanhos pequenos não deve prever tempos sublineares
+    expoente = max(expoente, 1.0);
+    double logA = (somaY - expoente * somaX) / k;
+    return exp(logA + expoente * log(n));
+}
+
 void Benchmark::executarBenchmarkCompleto(const vector<double>& dados, 
-                                        vector<ResultadoBenchmark>& resultados) {
+                                        vector<ResultadoBenchmark>& resultados,
+                                        const vector<string>& selecionados) {
     cout << "\n=== INICIANDO BENCHMARK ===" << endl;
     cout << "Tamanho do array: " << dados.size() << " elementos" << endl;
     cout << "================================" << endl;
     
-    // Teste Insertion Sort
-    cout << "Testando Insertion Sort..." << endl;
-    resultados.push_back(medirTempo("Insertion Sort", dados, 
-        [](vector<double>& arr) { AlgoritmosOrdenacao::insertionSort(arr); }));
+    for (const AlgoritmoRegistrado& algoritmo : algoritmosRegistrados()) {
+        if (!selecionado(selecionados, algoritmo.nome)) continue;
+        
+        cout << "Testando " << algoritmo.nome << "..." << endl;
+        resultados.push_back(medirAlgoritmo(algoritmo, dados));
+    }
+    
+    executarBenchmarkTiposChave(dados, resultados, selecionados);
+    
+    cout << "\n=== BENCHMARK CONCLUÍDO ===" << endl;
+}
+
+void Benchmark::executarVarreduraDistribuicoes(const vector<Distribuicao>& distribuicoes,
+                                             const vector<size_t>& tamanhos,
+                                             const vector<string>& selecionados,
+                                             uint64_t semente,
+                                             vector<ResultadoBenchmark>& resultados,
+                                             double orcamentoMs) {
+    size_t inicio = resultados.size();
+    
+    // O abandono só vale para tamanhos maiores, então a ordem importa
+    vector<size_t> tamanhosOrdenados(tamanhos);
+    if (orcamentoMs > 0) sort(tamanhosOrdenados.begin(), tamanhosOrdenados.end());
+    
+    // Prazo do vigia: todas as execuções dentro do orçamento e uma folga
+    // para a cópia dos dados e a contagem de operações
+    int execucoes = configuracao.aquecimento + configuracao.repeticoes + 1;
+    double limiteFilhoMs = orcamentoMs * execucoes * 2 + 1000;
+    
+    for (Distribuicao distribuicao : distribuicoes) {
+        string nome = GeradorDistribuicoes::nome(distribuicao);
+        
+        // Por algoritmo: pontos (n, ms) medidos e se já estourou o orçamento
+        vector<vector<pair<double, double>>> medidos(algoritmosRegistrados().size());
+        vector<bool> abandonado(algoritmosRegistrados().size(), false);
+        
+        for (size_t tamanho : tamanhosOrdenados) {
+            ParametrosDistribuicao parametros;
+            parametros.tipo = distribuicao;
+            parametros.semente = semente;
+            
+            vector<double> dados = GeradorDistribuicoes::gerar(parametros, tamanho);
+            if (dados.size() != tamanho) {
+                cerr << "Distribuição " << nome << " não gerada para " << tamanho
+                     << " elementos" << endl;
+                continue;
+            }
+            
+            cout << "\n--- Distribuição " << nome << ", " << tamanho << " elementos ---" << endl;
+            size_t antes = resultados.size();
+            
+            if (orcamentoMs <= 0) {
+                executarBenchmarkCompleto(dados, resultados, selecionados);
+            } else {
+                const vector<AlgoritmoRegistrado>& algoritmos = algoritmosRegistrados();
+                for (size_t a = 0; a < algoritmos.size(); a++) {
+                    if (!selecionado(selecionados, algoritmos[a].nome)) continue;
+                    
+                    ResultadoBenchmark resultado;
+                    bool medido = false;
+                    if (!abandonado[a]) {
+                        cout << "Testando " << algoritmos[a].nome << "..." << endl;
+                        medido = medirEmProcessoFilho(algoritmos[a], dados, limiteFilhoMs, resultado);
+                        if (!medido || resultado.tempoMs > orcamentoMs) {
+                            cout << algoritmos[a].nome << " excedeu o orçamento de " << orcamentoMs
+                                 << " ms; tamanhos maiores serão extrapolados" << endl;
+                            abandonado[a] = true;
+                        }
+                        if (medido && resultado.sucesso) {
+                            medidos[a].push_back({static_cast<double>(tamanho), resultado.tempoMs});
+                        }
+                    }
+                    
+                    if (!medido) {
+                        // Ajuste nos três maiores tamanhos medidos
+                        vector<pair<double, double>> pontos(
+                            medidos[a].end() - min<size_t>(3, medidos[a].size()), medidos[a].end());
+                        double estimativa = extrapolarTempo(pontos, static_cast<double>(tamanho));
+                        if (estimativa < 0) continue;
+                        
+                        resultado = ResultadoBenchmark();
+                        resultado.nomeAlgoritmo = algoritmos[a].nome;
+                        resultado.tamanhoArray = tamanho;
+                        resultado.sucesso = false;
+                        resultado.extrapolado = true;
+                        resultado.repeticoes = 0;
+                        resultado.tempoMs = resultado.medianaMs = estimativa;
+                        resultado.icInferiorMs = resultado.icSuperiorMs = estimativa;
+                    }
+                    resultados.push_back(resultado);
+                }
+                executarBenchmarkTiposChave(dados, resultados, selecionados);
+            }
+            
+            for (size_t i = antes; i < resultados.size(); i++) {
+                resultados[i].distribuicao = nome;
+            }
+        }
+    }
+    
+    imprimirMatrizDistribuicoes(vector<ResultadoBenchmark>(resultados.begin() + inicio,
+                                                           resultados.end()));
+}
+
+void Benchmark::imprimirMatrizDistribuicoes(const vector<ResultadoBenchmark>& resultados) {
+    vector<string> distribuicoes, algoritmos;
+    vector<size_t> tamanhos;
+    for (const auto& resultado : resultados) {
+        if (find(distribuicoes.begin(), distribuicoes.end(), resultado.distribuicao) == distribuicoes.end())
+            distribuicoes.push_back(resultado.distribuicao);
+        if (find(algoritmos.begin(), algoritmos.end(), resultado.nomeAlgoritmo) == algoritmos.end())
+            algoritmos.push_back(resultado.nomeAlgoritmo);
+        if (find(tamanhos.begin(), tamanhos.end(), resultado.tamanhoArray) == tamanhos.end())
+            tamanhos.push_back(resultado.tamanhoArray);
+    }
+    
+    // Uma matriz algoritmo x distribuição (mediana em ms) por tamanho
+    for (size_t tamanho : tamanhos) {
+        cout << "\n=== MEDIANA (ms) POR DISTRIBUIÇÃO - " << tamanho << " elementos ===" << endl;
+        cout << left << setw(24) << "Algoritmo";
+        for (const string& distribuicao : distribuicoes) cout << setw(16) << distribuicao;
+        cout << endl;
+        cout << string(24 + 16 * distribuicoes.size(), '-') << endl;
+        
+        for (const string& algoritmo : algoritmos) {
+            cout << left << setw(24) << algoritmo;
+            for (const string& distribuicao : distribuicoes) {
+                auto it = find_if(resultados.begin(), resultados.end(), [&](const ResultadoBenchmark& r) {
+                    return r.tamanhoArray == tamanho && r.nomeAlgoritmo == algoritmo &&
+                           r.distribuicao == distribuicao;
+                });
+                if (it == resultados.end()) cout << setw(16) << "-";
+                else if (it->extrapolado) {
+                    ostringstream estimativa;
+                    estimativa << "~" << fixed << setprecision(1) << it->tempoMs;
+                    cout << setw(16) << estimativa.str();
+                }
+                else if (!it->sucesso) cout << setw(16) << "ERRO";
+                else cout << setw(16) << fixed << setprecision(3) << it->tempoMs;
+            }
+            cout << endl;
+        }
+    }
+}
+
+void Benchmark::executarBenchmarkTiposChave(const vector<double>& dados,
+                                          vector<ResultadoBenchmark>& resultados,
+                                          const vector<string>& selecionados) {
+    bool inteiros = true;
+    bool cabeEmInt32 = true;
+    for (double valor : dados) {
+        if (valor != trunc(valor) || fabs(valor) > 9.0e15) {
+            inteiros = false;
+            break;
+        }
+        if (valor < numeric_limits<int32_t>::min() || valor > numeric_limits<int32_t>::max()) {
+            cabeEmInt32 = false;
+        }
+    }
+    
+    if (!inteiros) return;
+    
+    if (selecionado(selecionados, "Introsort (int64)")) {
+        cout << "Testando Introsort (int64)..." << endl;
+        vector<int64_t> dados64(dados.begin(), dados.end());
+        resultados.push_back(medirTempoTipado("Introsort (int64)", dados64,
+            [](vector<int64_t>& arr) { AlgoritmosOrdenacao::introsort(arr); }));
+    }
+    
+    if (cabeEmInt32 && selecionado(selecionados, "Introsort (int32)")) {
+        cout << "Testando Introsort (int32)..." << endl;
+        vector<int32_t> dados32(dados.begin(), dados.end());
+        resultados.push_back(medirTempoTipado("Introsort (int32)", dados32,
+            [](vector<int32_t>& arr) { AlgoritmosOrdenacao::introsort(arr); }));
+    }
+}
+
+ConfiguracaoDespacho Benchmark::executarAutoajuste(const vector<Distribuicao>& distribuicoes,
+                                                  const vector<size_t>& tamanhos, uint64_t semente,
+                                                  vector<ResultadoBenchmark>& resultados) {
+    cout << "\n=== AUTOAJUSTE (semente " << semente << ") ===" << endl;
+    cout << "Despacho atual: " << DespachoOrdenacao::descricao() << endl;
+    
+    // Entradas geradas uma vez e reaproveitadas por todos os candidatos
+    struct Entrada {
+        string distribuicao;
+        size_t tamanho;
+        vector<double> dados;
+    };
+    vector<Entrada> entradas;
+    for (Distribuicao distribuicao : distribuicoes) {
+        for (size_t tamanho : tamanhos) {
+            ParametrosDistribuicao parametros;
+            parametros.tipo = distribuicao;
+            parametros.semente = semente;
+            entradas.push_back({GeradorDistribuicoes::nome(distribuicao), tamanho,
+                                GeradorDistribuicoes::gerar(parametros, tamanho)});
+        }
+    }
+    
+    // Média geométrica das medianas nas entradas escolhidas: nenhuma
+    // entrada grande domina a decisão. Infinito se alguma falhar.
+    auto avaliar = [&](const string& nome, const function<void(vector<double>&)>& ordenar,
+                       const function<bool(const Entrada&)>& incluir, bool registrar) {
+        double somaLog = 0;
+        size_t medidas = 0;
+        for (const Entrada& entrada : entradas) {
+            if (!incluir(entrada)) continue;
+            ResultadoBenchmark resultado = medirTempo(nome, entrada.dados, ordenar);
+            resultado.distribuicao = entrada.distribuicao;
+            if (registrar) resultados.push_back(resultado);
+            if (!resultado.sucesso) {
+                cerr << "ERRO: " << nome << " não ordenou corretamente!" << endl;
+                return numeric_limits<double>::infinity();
+            }
+            somaLog += log(max(resultado.tempoMs, 1e-6));
+            medidas++;
+        }
+        return medidas ? exp(somaLog / medidas) : numeric_limits<double>::infinity();
+    };
+    auto todas = [](const Entrada&) { return true; };
+    
+    ConfiguracaoDespacho ajuste;
+    
+    // 1. Limiar da folha x fator do limite de profundidade
+    cout << "\nLimiar de inserção x fator de profundidade (média geométrica, ms):" << endl;
+    double melhor = numeric_limits<double>::infinity();
+    for (ptrdiff_t limiar : {8, 12, 16, 24, 32, 48, 64}) {
+        for (double fator : {1.0, 1.5, 2.0, 3.0}) {
+            ParametrosIntrosort parametros = {limiar, fator};
+            double tempo = avaliar("Introsort (ajustado)",
+                                   [&](vector<double>& arr) {
+                                       DespachoOrdenacao::introsort(arr, parametros);
+                                   },
+                                   todas, false);
+            // Formatação num fluxo local: o estado de cout fica como estava
+            ostringstream medida;
+            medida << fixed << setprecision(1) << fator << " log2(n): " << setprecision(3) << tempo;
+            cout << "  folha <= " << setw(2) << limiar << ", " << medida.str() << endl;
+            if (tempo < melhor) {
+                melhor = tempo;
+                ajuste.introsort = parametros;
+            }
+        }
+    }
+    ostringstream fator;
+    fator << fixed << setprecision(1) << ajuste.introsort.fatorProfundidade;
+    cout << "Escolhido: folha <= " << ajuste.introsort.limiarInsercao << ", " << fator.str()
+         << " log2(n)" << endl;
+    
+    // Referência: o introsort manual, com os limiares fixos
+    avaliar("Introsort (manual)", [](vector<double>& arr) { AlgoritmosOrdenacao::introsort(arr); },
+            todas, true);
+    
+    // 2. Algoritmo por tamanho, com o introsort já ajustado e o vetorial
+    //    como candidatos. Cada tamanho medido vale até a média geométrica
+    //    com o seguinte.
+    DespachoOrdenacao::configurar(ajuste, "autoajuste");
+    vector<size_t> ordenados(tamanhos);
+    sort(ordenados.begin(), ordenados.end());
+    ordenados.erase(unique(ordenados.begin(), ordenados.end()), ordenados.end());
+    cout << "\nAlgoritmo por tamanho:" << endl;
+    for (size_t i = 0; i < ordenados.size(); i++) {
+        size_t tamanho = ordenados[i];
+        AlgoritmoDespacho escolhido = AlgoritmoDespacho::IntrosortAjustado;
+        melhor = numeric_limits<double>::infinity();
+        for (AlgoritmoDespacho algoritmo : DespachoOrdenacao::algoritmos()) {
+            double tempo = avaliar(DespachoOrdenacao::nomeAlgoritmo(algoritmo),
+                                   [algoritmo](vector<double>& arr) {
+                                       DespachoOrdenacao::executar(algoritmo, arr);
+                                   },
+                                   [tamanho](const Entrada& entrada) { return entrada.tamanho == tamanho; },
+                                   true);
+            if (tempo < melhor) {
+                melhor = tempo;
+                escolhido = algoritmo;
+            }
+        }
+        size_t limite = i + 1 < ordenados.size()
+                            ? static_cast<size_t>(sqrt(static_cast<double>(tamanho) * ordenados[i + 1]))
+                            : 0;
+        ostringstream tempo;
+        tempo << fixed << setprecision(3) << melhor;
+        cout << "  n = " << tamanho << ": " << DespachoOrdenacao::nomeAlgoritmo(escolhido) << " ("
+             << tempo.str() << " ms)" << endl;
+        
+        // Faixas vizinhas com o mesmo algoritmo viram uma só
+        if (!ajuste.faixas.empty() && ajuste.faixas.back().algoritmo == escolhido) {
+            ajuste.faixas.back().ateTamanho = limite;
+        } else {
+            ajuste.faixas.push_back({limite, escolhido});
+        }
+    }
+    
+    DespachoOrdenacao::configurar(ajuste, "autoajuste");
+    cout << "\nDespacho ajustado: " << DespachoOrdenacao::descricao() << endl;
+    return ajuste;
+}
+
+void Benchmark::executarBenchmarkMultiChave(const TabelaColunas& tabela,
+                                          const vector<ChaveOrdenacao>& chaves,
+                                          vector<ResultadoBenchmark>& resultados) {
+    cout << "\n=== BENCHMARK MULTICHAVE ===" << endl;
+    cout << "Linhas: " << tabela.numLinhas() << " | Chaves:";
+    for (const ChaveOrdenacao& chave : chaves) {
+        cout << " " << tabela.nomes[chave.coluna] << (chave.crescente ? " (asc)" : " (desc)");
+    }
+    cout << endl;
+    
+    int largura = OrdenacaoMultiChave::larguraEmpacotada(tabela, chaves);
+    cout << "Chave empacotada: " << (largura == 0 ? string("não cabe em 128 bits") :
+                                     to_string(largura) + " bits") << endl;
+    
+    string sufixo = " (" + to_string(chaves.size()) + " chaves)";
+    vector<size_t> referencia;
+    
+    struct Variante {
+        string nome;
+        vector<size_t> (*ordenar)(const TabelaColunas&, const vector<ChaveOrdenacao>&);
+    };
+    const Variante variantes[] = {
+        {"Multichave lexicográfico", OrdenacaoMultiChave::ordenarLexicografico},
+        {"Multichave empacotado", OrdenacaoMultiChave::ordenarEmpacotado}};
+    
+    for (const Variante& variante : variantes) {
+        cout << "Testando " << variante.nome << "..." << endl;
+        
+        vector<size_t> permutacao;
+        resultados.push_back(medirRegiao(
+            variante.nome + sufixo, tabela.numLinhas(), []() {},
+            [&]() { permutacao = variante.ordenar(tabela, chaves); },
+            [&]() {
+                // Ambas as variantes são estáveis, então a permutação tem de ser idêntica
+                if (referencia.empty()) referencia = permutacao;
+                return permutacao == referencia;
+            }));
+    }
+}
+
+namespace {
+
+// Colunas de carga movidas junto com a chave no benchmark de permutação
+const size_t COLUNAS_CARGA = 20;
+
+// A mesma tabela guardada por linhas (array-of-structs, 168 bytes)
+struct LinhaTabela {
+    double chave;
+    double cargas[COLUNAS_CARGA];
+};
+
+// Igualdade bit a bit: a mesma permutação move os mesmos bits, e == daria
+// falso com NaN
+bool mesmosBits(double a, double b) {
+    return memcmp(&a, &b, sizeof(double)) == 0;
+}
+
+bool mesmosBits(const vector<double>& a, const vector<double>& b) {
+    return a.size() == b.size() &&
+           (a.empty() || memcmp(a.data(), b.data(), a.size() * sizeof(double)) == 0);
+}
+
+}
+
+void Benchmark::executarBenchmarkPermutacao(const TabelaColunas& tabela, size_t colunaChave,
+                                           vector<ResultadoBenchmark>& resultados) {
+    size_t n = tabela.numLinhas();
+    if (n == 0 || colunaChave >= tabela.numColunas()) return;
+    
+    // Chave na coluna 0 e 20 cargas tiradas das colunas lidas, em rodízio:
+    // o custo de mover não depende dos valores
+    TabelaColunas original;
+    original.nomes.push_back(tabela.nomes[colunaChave]);
+    original.colunas.push_back(tabela.colunas[colunaChave]);
+    for (size_t c = 0; c < COLUNAS_CARGA; c++) {
+        size_t fonte = c % tabela.numColunas();
+        original.nomes.push_back(tabela.nomes[fonte] + " #" + to_string(c + 1));
+        original.colunas.push_back(tabela.colunas[fonte]);
+    }
+    
+    vector<LinhaTabela> linhasOriginais(n);
+    for (size_t i = 0; i < n; i++) {
+        linhasOriginais[i].chave = original.colunas[0][i];
+        for (size_t c = 0; c < COLUNAS_CARGA; c++) {
+            linhasOriginais[i].cargas[c] = original.colunas[c + 1][i];
+        }
+    }
+    
+    cout << "\n=== BENCHMARK ARGSORT + PERMUTAÇÃO DE COLUNAS ===" << endl;
+    cout << "Linhas: " << n << " | Chave: " << original.nomes[0] << " | " << COLUNAS_CARGA
+         << " colunas de carga" << endl;
+    
+    unsigned nucleos = max(1u, thread::hardware_concurrency());
+    
+    struct VariantePermutacao {
+        string nome;
+        bool argsortPares;
+        AplicacaoPermutacao aplicacao;
+        unsigned numThreads;
+    };
+    const vector<VariantePermutacao> variantes = {
+        {"Argsort + gather", true, AplicacaoPermutacao::Gather, 1},
+        {"Argsort + gather em blocos", true, AplicacaoPermutacao::GatherBlocos, 1},
+        {"Argsort + ciclos in-place", true, AplicacaoPermutacao::Ciclos, 1},
+        {"Argsort + blocos paralelo", true, AplicacaoPermutacao::GatherBlocos, nucleos},
+        {"Argsort indireto + blocos", false, AplicacaoPermutacao::GatherBlocos, 1}};
+    
+    // Ponta a ponta: argsort da chave e reordenação de todas as colunas.
+    // O argsort é estável, então todas as variantes devem chegar à mesma tabela.
+    TabelaColunas referencia;
+    TabelaColunas trabalho;
+    for (const VariantePermutacao& variante : variantes) {
+        cout << "Testando " << variante.nome << "..." << endl;
+        vector<size_t> permutacao;
+        auto verificar = [&]() {
+            bool correto = true;
+            if (referencia.colunas.empty()) {
+                // Chave em ordem e empates na ordem original das linhas
+                for (size_t i = 1; i < n && correto; i++) {
+                    uint64_t anterior = AlgoritmosOrdenacao::chaveCanonica(trabalho.colunas[0][i - 1]);
+                    uint64_t atual = AlgoritmosOrdenacao::chaveCanonica(trabalho.colunas[0][i]);
+                    correto = anterior < atual ||
+                              (anterior == atual && permutacao[i - 1] < permutacao[i]);
+                }
+                referencia = trabalho;
+            } else {
+                correto = trabalho.colunas.size() == referencia.colunas.size();
+                for (size_t c = 0; c < trabalho.colunas.size() && correto; c++) {
+                    correto = mesmosBits(trabalho.colunas[c], referencia.colunas[c]);
+                }
+            }
+            return correto;
+        };
+        resultados.push_back(medirRegiao(
+            variante.nome, n, [&]() { trabalho = original; },
+            [&]() {
+                permutacao = variante.argsortPares
+                                 ? OrdenacaoIndireta::argsort(trabalho.colunas[0])
+                                 : OrdenacaoIndireta::argsortIndireto(trabalho.colunas[0]);
+                OrdenacaoIndireta::aplicarPermutacao(trabalho, permutacao, variante.aplicacao,
+                                                     variante.numThreads);
+            },
+            verificar));
+    }
+    
+    // Mesma ordenação com as linhas inteiras: cada movimento leva 168 bytes
+    cout << "Testando Linhas inteiras (struct)..." << endl;
+    vector<LinhaTabela> linhas;
+    resultados.push_back(medirRegiao(
+        "Linhas inteiras (struct)", n, [&]() { linhas = linhasOriginais; },
+        [&]() {
+            stable_sort(linhas.begin(), linhas.end(), [](const LinhaTabela& a, const LinhaTabela& b) {
+                return AlgoritmosOrdenacao::chaveCanonica(a.chave) <
+                       AlgoritmosOrdenacao::chaveCanonica(b.chave);
+            });
+        },
+        [&]() {
+            bool correto = !referencia.colunas.empty();
+            for (size_t i = 0; i < n && correto; i++) {
+                correto = mesmosBits(linhas[i].chave, referencia.colunas[0][i]);
+                for (size_t c = 0; c < COLUNAS_CARGA && correto; c++) {
+                    correto = mesmosBits(linhas[i].cargas[c], referencia.colunas[c + 1][i]);
+                }
+            }
+            return correto;
+        }));
+}
+
+void Benchmark::executarBenchmarkIncremental(const vector<double>& dados, size_t tamanhoLote,
+                                            vector<ResultadoBenchmark>& resultados) {
+    size_t n = dados.size();
+    tamanhoLote = min(tamanhoLote, n);
+    if (tamanhoLote == 0) return;
+    
+    cout << "\n=== BENCHMARK REORDENAÇÃO INCREMENTAL ===" << endl;
+    cout << "Coluna: " << n << " linhas | Lote: " << tamanhoLote << " valores" << endl;
+    
+    // Coluna já ordenada seguida de um lote de linhas novas
+    vector<double> comLote(dados.begin(), dados.end() - tamanhoLote);
+    AlgoritmosOrdenacao::stdSort(comLote);
+    size_t tamanhoOrdenado = comLote.size();
+    comLote.insert(comLote.end(), dados.end() - tamanhoLote, dados.end());
     
-    // Teste Shell Sort
-    cout << "Testando Shell Sort..." << endl;
-    resultados.push_back(medirTempo("Shell Sort", dados,
-        [](vector<double>& arr) { AlgoritmosOrdenacao::shellSort(arr); }));
+    // Coluna ordenada com valores editados em posições sorteadas
+    vector<double> ordenada(dados);
+    AlgoritmosOrdenacao::stdSort(ordenada);
+    mt19937 gerador(42);
+    uniform_int_distribution<size_t> posicao(0, n - 1);
+    vector<pair<size_t, double>> alteracoes;
+    vector<double> editada(ordenada);
+    for (size_t i = 0; i < tamanhoLote; i++) {
+        alteracoes.push_back({posicao(gerador), dados[posicao(gerador)]});
+        editada[alteracoes.back().first] = alteracoes.back().second;
+    }
     
-    // Teste Quick Sort
-    cout << "Testando Quick Sort..." << endl;
-    resultados.push_back(medirTempo("Quick Sort", dados,
-        [](vector<double>& arr) { AlgoritmosOrdenacao::quickSort(arr); }));
+    string sufixo = " (lote " + to_string(tamanhoLote) + ")";
     
-    // Teste Introsort (manual)
-    cout << "Testando Introsort (manual)..." << endl;
-    resultados.push_back(medirTempo("Introsort (manual)", dados,
+    cout << "Testando Reordenação incremental..." << endl;
+    resultados.push_back(medirTempo("Incremental acrescentado" + sufixo, comLote,
+        [tamanhoOrdenado](vector<double>& arr) {
+            AlgoritmosOrdenacao::reordenarIncremental(arr, tamanhoOrdenado);
+        }));
+    resultados.push_back(medirTempo("Power Sort acrescentado" + sufixo, comLote,
+        [](vector<double>& arr) { AlgoritmosOrdenacao::powerSort(arr); }));
+    resultados.push_back(medirTempo("Introsort acrescentado" + sufixo, comLote,
         [](vector<double>& arr) { AlgoritmosOrdenacao::introsort(arr); }));
     
-    // Teste std::sort
-    cout << "Testando std::sort..." << endl;
-    resultados.push_back(medirTempo("std::sort", dados,
-        [](vector<double>& arr) { AlgoritmosOrdenacao::stdSort(arr); }));
+    resultados.push_back(medirTempo("Incremental alterado" + sufixo, ordenada,
+        [&alteracoes](vector<double>& arr) {
+            AlgoritmosOrdenacao::atualizarOrdenado(arr, alteracoes);
+        }));
+    resultados.push_back(medirTempo("Power Sort alterado" + sufixo, editada,
+        [](vector<double>& arr) { AlgoritmosOrdenacao::powerSort(arr); }));
+    resultados.push_back(medirTempo("Introsort alterado" + sufixo, editada,
+        [](vector<double>& arr) { AlgoritmosOrdenacao::introsort(arr); }));
+}
+
+void Benchmark::executarBenchmarkTopK(const vector<double>& dados, const vector<size_t>& ks,
+                                     vector<ResultadoBenchmark>& resultados) {
+    size_t n = dados.size();
+    if (n == 0) return;
     
-    cout << "\n=== BENCHMARK CONCLUÍDO ===" << endl;
+    cout << "\n=== BENCHMARK SELEÇÃO TOP-K ===" << endl;
+    cout << "Tamanho do array: " << n << " elementos" << endl;
+    
+    vector<double> referencia(dados);
+    AlgoritmosOrdenacao::stdSort(referencia);
+    
+    // Referência de custo: ordenar tudo para ficar com os k primeiros
+    cout << "Testando Introsort (array inteiro)..." << endl;
+    resultados.push_back(medirTempo("Introsort (array inteiro)", dados,
+        [](vector<double>& arr) { AlgoritmosOrdenacao::introsort(arr); }));
+    
+    vector<size_t> valoresK(ks);
+    sort(valoresK.begin(), valoresK.end());
+    valoresK.erase(unique(valoresK.begin(), valoresK.end()), valoresK.end());
+    
+    for (size_t k : valoresK) {
+        if (k == 0 || k > n) continue;
+        string sufixo = " (k=" + to_string(k) + ")";
+        cout << "Testando seleção" << sufixo << "..." << endl;
+        
+        resultados.push_back(medirTempoVerificado("Partial Sort" + sufixo, dados,
+            [k](vector<double>& arr) { AlgoritmosOrdenacao::partialSort(arr, k); },
+            [&referencia, k](const vector<double>& arr) {
+                return equal(arr.begin(), arr.begin() + k, referencia.begin());
+            }));
+        
+        // O k-ésimo menor fica na posição k - 1
+        resultados.push_back(medirTempoVerificado("nth_element" + sufixo, dados,
+            [k](vector<double>& arr) { AlgoritmosOrdenacao::nthElement(arr, k - 1); },
+            [&referencia, k](const vector<double>& arr) {
+                double pivo = arr[k - 1];
+                return pivo == referencia[k - 1] &&
+                       all_of(arr.begin(), arr.begin() + k, [pivo](double v) { return v <= pivo; }) &&
+                       all_of(arr.begin() + k, arr.end(), [pivo](double v) { return v >= pivo; });
+            }));
+        
+        // Lê a entrada sem modificá-la, como faria sobre um fluxo
+        vector<double> selecionados;
+        resultados.push_back(medirTempoVerificado("Top-k em fluxo" + sufixo, dados,
+            [k, &selecionados](vector<double>& arr) {
+                ordenacao::TopK<double> topK(k);
+                topK.adicionar(arr.data(), arr.size());
+                selecionados = topK.resultado();
+            },
+            [&referencia, &selecionados](const vector<double>&) {
+                return equal(selecionados.begin(), selecionados.end(), referencia.begin(),
+                             referencia.begin() + selecionados.size()) &&
+                       !selecionados.empty();
+            }));
+    }
+}
+
+void Benchmark::executarBenchmarkTexto(const ColunaTexto& coluna, const vector<size_t>& tamanhos,
+                                      vector<ResultadoBenchmark>& resultados) {
+    struct OrdenacaoTextoRegistrada {
+        string nome;
+        function<void(ColunaTexto&)> ordenar;
+    };
+    const vector<OrdenacaoTextoRegistrada> algoritmos = {
+        {"std::sort (texto)", OrdenacaoTexto::stdSort},
+        {"Multikey Quicksort", [](ColunaTexto& c) { OrdenacaoTexto::multikeyQuicksort(c); }},
+        {"MSD Radix Sort", [](ColunaTexto& c) { OrdenacaoTexto::msdRadixSort(c); }}};
+    
+    cout << "\n=== BENCHMARK COLUNA DE TEXTO ===" << endl;
+    cout << "Coluna: " << coluna.nome << " | " << coluna.size() << " textos, "
+         << coluna.bytes() << " bytes" << endl;
+    
+    for (size_t n : tamanhos) {
+        if (n == 0 || n > coluna.size()) continue;
+        cout << "\n--- Testando " << n << " textos ---" << endl;
+        ColunaTexto original = coluna.prefixo(n);
+        
+        // Ordem de bytes: cada repetição restaura as visões, a arena é a mesma
+        ColunaTexto trabalho = original;
+        for (const auto& algoritmo : algoritmos) {
+            cout << "Testando " << algoritmo.nome << "..." << endl;
+            resultados.push_back(medirRegiao(
+                algoritmo.nome, n, [&]() { trabalho.visoes() = original.visoes(); },
+                [&]() { algoritmo.ordenar(trabalho); },
+                [&]() { return OrdenacaoTexto::verificarOrdenacao(trabalho); }));
+        }
+        
+        // Colação: chaves geradas dentro da região medida. Como o índice da
+        // linha desempata as chaves, todos os algoritmos devem produzir a
+        // mesma permutação.
+        for (Colacao colacao : {Colacao::Primaria, Colacao::Secundaria, Colacao::Terciaria}) {
+            string sufixo = string(" (") + OrdenacaoTexto::nomeColacao(colacao) + ")";
+            cout << "Testando colação" << sufixo << "..." << endl;
+            
+            ColunaTexto chaves;
+            resultados.push_back(medirRegiao(
+                "Chaves de colação" + sufixo, n, []() {},
+                [&]() { chaves = OrdenacaoTexto::gerarChaves(original, colacao); },
+                [&]() { return chaves.size() == n; }));
+            
+            vector<size_t> referencia;
+            for (const auto& algoritmo : algoritmos) {
+                // "std::sort (texto)" -> "std::sort (texto/primária)"; sem
+                // vírgula, que quebraria o CSV
+                const string& nome = algoritmo.nome;
+                string nomeColacao =
+                    nome.back() == ')' ? nome.substr(0, nome.size() - 1) + "/" +
+                                             OrdenacaoTexto::nomeColacao(colacao) + ")"
+                                       : nome + sufixo;
+                vector<size_t> permutacao;
+                resultados.push_back(medirRegiao(
+                    nomeColacao, n, []() {},
+                    [&]() {
+                        permutacao = OrdenacaoTexto::ordenarPorColacao(original, colacao,
+                                                                       algoritmo.ordenar);
+                    },
+                    [&]() {
+                        if (!referencia.empty()) return permutacao == referencia;
+                        ColunaTexto ordenadas = chaves;
+                        ordenadas.aplicarPermutacao(permutacao);
+                        referencia = permutacao;
+                        return OrdenacaoTexto::verificarOrdenacao(ordenadas);
+                    }));
+            }
+        }
+    }
+}
+
+void Benchmark::executarBenchmarkCelulas(const ColunaCelulas& coluna, const vector<size_t>& tamanhos,
+                                        vector<ResultadoBenchmark>& resultados) {
+    cout << "\n=== BENCHMARK COLUNA MISTA (CALC) ===" << endl;
+    cout << "Coluna: " << coluna.nome << " | " << coluna.size() << " células: "
+         << coluna.contar(TipoCelula::Numero) << " números, " << coluna.contar(TipoCelula::Texto)
+         << " textos, " << coluna.contar(TipoCelula::Erro) << " erros, "
+         << coluna.contar(TipoCelula::Vazia) << " vazias" << endl;
+    
+    for (size_t n : tamanhos) {
+        if (n == 0 || n > coluna.size()) continue;
+        cout << "\n--- Testando " << n << " células ---" << endl;
+        ColunaCelulas original = coluna.prefixo(n);
+        vector<ValorCelula> variantes = OrdenacaoCelulas::paraVariantes(original);
+        
+        for (bool crescente : {true, false}) {
+            string sufixo = crescente ? "" : " (decrescente)";
+            
+            // Cópias fora da região medida: as duas estratégias partem da
+            // mesma coluna, cada uma na sua representação
+            cout << "Testando Particionado" << sufixo << "..." << endl;
+            ColunaCelulas trabalho;
+            ResultadoBenchmark particionado = medirRegiao(
+                "Particionado" + sufixo, n, [&]() { trabalho = original; },
+                [&]() { OrdenacaoCelulas::ordenarParticionado(trabalho, crescente); },
+                [&]() { return OrdenacaoCelulas::verificarOrdenacao(trabalho, crescente); });
+            resultados.push_back(particionado);
+            
+            // As duas são estáveis: devem concordar célula a célula
+            cout << "Testando Comparador variant" << sufixo << "..." << endl;
+            vector<ValorCelula> valores;
+            resultados.push_back(medirRegiao(
+                "Comparador variant" + sufixo, n, [&]() { valores = variantes; },
+                [&]() { OrdenacaoCelulas::ordenarGenerico(valores, crescente); },
+                [&]() { return particionado.sucesso && OrdenacaoCelulas::iguais(trabalho, valores); }));
+        }
+    }
+}
+
+void Benchmark::executarBenchmarkExterno(const string& arquivoEntrada, size_t memoriaBytes,
+                                         vector<ResultadoBenchmark>& resultados, size_t kTopK) {
+    cout << "\n=== BENCHMARK ORDENAÇÃO EXTERNA ===" << endl;
+    cout << "Entrada: " << arquivoEntrada << " | Memória: " << memoriaBytes / (1024 * 1024)
+         << " MB" << endl;
+    cout << "Testando Ordenação externa..." << endl;
+    
+    string arquivoSaida = arquivoEntrada + ".ordenado";
+    EstatisticasOrdenacaoExterna estatisticas;
+    ResultadoBenchmark resultado;
+    
+    // Uma execução só (a entrada pode passar da RAM), fora de
+    // coletarAmostras, mas com a mesma contabilidade de memória e os
+    // mesmos contadores em volta da região medida
+    ContadoresHardware hardware;
+    bool usarContadores = configuracao.contadoresHardware && hardware.disponivel();
+    ContadorAlocacoes::iniciar();
+    if (usarContadores) hardware.iniciar();
+    bool ok = OrdenacaoExterna::ordenarArquivo(arquivoEntrada, arquivoSaida, memoriaBytes,
+                                               &estatisticas);
+    if (usarContadores) resultado.contadores = hardware.parar();
+    resultado.alocacoes = ContadorAlocacoes::parar();
+    
+    uint64_t elementosSaida = 0;
+    resultado.nomeAlgoritmo = "Ordenação externa";
+    resultado.tamanhoArray = estatisticas.elementos;
+    // Outra tarefa que o Top-k (ordena tudo, em disco): fica fora da
+    // escolha do melhor
+    resultado.concorre = false;
+    resumirAmostras({estatisticas.tempoMs}, resultado);
+    resultado.sucesso = ok && OrdenacaoExterna::verificarArquivo(arquivoSaida, &elementosSaida) &&
+                        elementosSaida == estatisticas.elementos;
+    
+    // Os k primeiros da saída ordenada conferem a seleção em fluxo
+    size_t k = static_cast<size_t>(min<uint64_t>(kTopK, estatisticas.elementos));
+    vector<double> primeiros(k);
+    FILE* ordenado = fopen(arquivoSaida.c_str(), "rb");
+    bool primeirosLidos = ordenado && fread(primeiros.data(), sizeof(double), k, ordenado) == k;
+    if (ordenado) fclose(ordenado);
+    remove(arquivoSaida.c_str());
+    
+    if (!resultado.sucesso) {
+        cerr << "ERRO: Ordenação externa não ordenou corretamente!" << endl;
+    }
+    
+    double mb = 1024.0 * 1024.0;
+    cout << "Elementos: " << estatisticas.elementos << " | Runs: " << estatisticas.runs
+         << " | Passadas de merge: " << estatisticas.passadasMerge << endl;
+    cout << "E/S: " << estatisticas.bytesLidos / mb << " MB lidos, "
+         << estatisticas.bytesEscritos / mb << " MB escritos" << endl;
+    
+    resultados.push_back(resultado);
+    
+    if (k == 0) return;
+    cout << "Testando Top-k externo (k=" << k << ")..." << endl;
+    
+    vector<double> menores;
+    bool selecionou = true;
+    resultados.push_back(medirRegiao(
+        "Top-k externo (k=" + to_string(k) + ")", estatisticas.elementos, []() {},
+        [&]() { selecionou = OrdenacaoExterna::topK(arquivoEntrada, k, menores) && selecionou; },
+        [&]() { return selecionou && primeirosLidos && menores == primeiros; }));
+}
+
+namespace {
+
+// Ambiente da execução seguido da configuração de medição, gravados junto
+// dos resultados para que duas execuções possam ser comparadas
+vector<pair<string, string>> camposProcedencia(const ConfiguracaoMedicao& medicao) {
+    vector<pair<string, string>> campos = AmbienteExecucao::capturar().campos();
+    campos.push_back({"aquecimento", to_string(medicao.aquecimento)});
+    campos.push_back({"repeticoes", to_string(medicao.repeticoes)});
+    campos.push_back({"remover_outliers", medicao.removerOutliers ? "sim" : "nao"});
+    campos.push_back({"reamostragens_bootstrap", to_string(medicao.reamostragensBootstrap)});
+    ostringstream confianca;
+    confianca << medicao.nivelConfianca;
+    campos.push_back({"nivel_confianca", confianca.str()});
+    campos.push_back({"cpu_fixa", medicao.cpuFixa >= 0 ? to_string(medicao.cpuFixa) : "livre"});
+    return campos;
+}
+
+string escaparJSON(const string& texto) {
+    string escapado;
+    for (char c : texto) {
+        if (c == '"' || c == '\\') {
+            escapado += '\\';
+            escapado += c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            char codigo[8];
+            snprintf(codigo, sizeof(codigo), "\\u%04x", c);
+            escapado += codigo;
+        } else {
+            escapado += c;
+        }
+    }
+    return escapado;
+}
+
+vector<string> dividirCampos(const string& linha) {
+    vector<string> campos;
+    stringstream fluxo(linha);
+    string campo;
+    while (getline(fluxo, campo, ',')) campos.push_back(campo);
+    if (!linha.empty() && linha.back() == ',') campos.push_back("");
+    return campos;
+}
+
 }
 
 void Benchmark::salvarResultados(const vector<ResultadoBenchmark>& resultados, 
@@ -80,49 +1238,439 @@ void Benchmark::salvarResultados(const vector<ResultadoBenchmark>& resultados,
         return;
     }
     
+    // Procedência em linhas de comentário antes do cabeçalho (lidas por
+    // carregarResultados; o pandas as ignora com comment='#')
+    for (const auto& campo : camposProcedencia(configuracao)) {
+        arquivo << "# " << campo.first << ": " << campo.second << "\n";
+    }
+    
     // Cabeçalho CSV
-    arquivo << "Algoritmo,Tempo_ms,Tamanho_Array,Sucesso" << endl;
+    arquivo << "Algoritmo,Tempo_ms,Tamanho_Array,Sucesso,Distribuicao,Repeticoes,Outliers,Min_ms,"
+               "Mediana_ms,Media_ms,Desvio_ms,P95_ms,IC_Inf_ms,IC_Sup_ms";
+    for (int e = 0; e < NUM_EVENTOS; e++) arquivo << "," << ContadoresHardware::nomeEvento(e);
+    arquivo << ",IPC,Alocacoes,Bytes_Alocados,Pico_Bytes,RSS_Max_KB,Comparacoes,Movimentos,Trocas,"
+               "Profundidade_Max,Fallbacks_Heap,Folhas_Insercao,Extrapolado" << endl;
     
     for (const auto& resultado : resultados) {
         arquivo << resultado.nomeAlgoritmo << ","
                 << fixed << setprecision(3) << resultado.tempoMs << ","
                 << resultado.tamanhoArray << ","
-                << (resultado.sucesso ? "Sim" : "Nao") << endl;
+                << (resultado.sucesso ? "Sim" : "Nao") << ","
+                << resultado.distribuicao << ","
+                << resultado.repeticoes << ","
+                << resultado.outliersRemovidos << ","
+                << setprecision(4) << resultado.minimoMs << ","
+                << resultado.medianaMs << ","
+                << resultado.mediaMs << ","
+                << resultado.desvioPadraoMs << ","
+                << resultado.p95Ms << ","
+                << resultado.icInferiorMs << ","
+                << resultado.icSuperiorMs;
+        
+        // Contador indisponível fica vazio (NaN no pandas), não zero
+        const LeituraContadores& contadores = resultado.contadores;
+        arquivo << setprecision(0);
+        for (int e = 0; e < NUM_EVENTOS; e++) {
+            arquivo << ",";
+            if (contadores.disponivel[e]) arquivo << contadores.valores[e];
+        }
+        arquivo << ",";
+        if (contadores.ipc() > 0) arquivo << setprecision(3) << contadores.ipc();
+        
+        const LeituraAlocacoes& alocacoes = resultado.alocacoes;
+        arquivo << "," << setprecision(1) << alocacoes.alocacoes
+                << "," << setprecision(0) << alocacoes.bytesAlocados
+                << "," << alocacoes.picoBytes
+                << "," << alocacoes.rssMaximoKb;
+        
+        const ContagemOperacoes& operacoes = resultado.operacoes;
+        if (resultado.operacoesContadas) {
+            arquivo << "," << operacoes.comparacoes << "," << operacoes.movimentos << ","
+                    << operacoes.trocas << "," << operacoes.profundidadeMaxima << ","
+                    << operacoes.fallbacksHeapSort << "," << operacoes.folhasInsercao;
+        } else {
+            arquivo << ",,,,,,";
+        }
+        arquivo << "," << (resultado.extrapolado ? "Sim" : "Nao");
+        arquivo << endl;
+    }
+    
+    arquivo.close();
+    cout << "Resultados salvos em: " << nomeArquivo << endl;
+}
+
+void Benchmark::salvarResultadosJSON(const vector<ResultadoBenchmark>& resultados,
+                                    const string& nomeArquivo) {
+    ofstream arquivo(nomeArquivo);
+    
+    if (!arquivo.is_open()) {
+        cerr << "Erro ao criar arquivo de resultados: " << nomeArquivo << endl;
+        return;
+    }
+    
+    arquivo << "{\n  \"ambiente\": {";
+    vector<pair<string, string>> procedencia = camposProcedencia(configuracao);
+    for (size_t i = 0; i < procedencia.size(); i++) {
+        arquivo << (i ? "," : "") << "\n    \"" << procedencia[i].first << "\": \""
+                << escaparJSON(procedencia[i].second) << "\"";
+    }
+    arquivo << "\n  },\n  \"resultados\": [";
+    
+    for (size_t i = 0; i < resultados.size(); i++) {
+        const ResultadoBenchmark& resultado = resultados[i];
+        arquivo << (i ? "," : "") << "\n    {"
+                << "\"algoritmo\": \"" << escaparJSON(resultado.nomeAlgoritmo) << "\", "
+                << "\"tamanho\": " << resultado.tamanhoArray << ", "
+                << "\"distribuicao\": \"" << escaparJSON(resultado.distribuicao) << "\", "
+                << "\"sucesso\": " << (resultado.sucesso ? "true" : "false") << ", "
+                << "\"extrapolado\": " << (resultado.extrapolado ? "true" : "false") << ", "
+                << "\"repeticoes\": " << resultado.repeticoes << ", "
+                << "\"outliers\": " << resultado.outliersRemovidos << ", "
+                << fixed << setprecision(4)
+                << "\"tempo_ms\": " << resultado.tempoMs << ", "
+                << "\"min_ms\": " << resultado.minimoMs << ", "
+                << "\"mediana_ms\": " << resultado.medianaMs << ", "
+                << "\"media_ms\": " << resultado.mediaMs << ", "
+                << "\"desvio_ms\": " << resultado.desvioPadraoMs << ", "
+                << "\"p95_ms\": " << resultado.p95Ms << ", "
+                << "\"ic_inf_ms\": " << resultado.icInferiorMs << ", "
+                << "\"ic_sup_ms\": " << resultado.icSuperiorMs << ", ";
+        
+        // Contador indisponível vira null, como a célula vazia do CSV
+        const LeituraContadores& contadores = resultado.contadores;
+        arquivo << "\"contadores\": {" << setprecision(0);
+        for (int e = 0; e < NUM_EVENTOS; e++) {
+            arquivo << (e ? ", " : "") << "\"" << ContadoresHardware::nomeEvento(e) << "\": ";
+            if (contadores.disponivel[e]) {
+                arquivo << contadores.valores[e];
+            } else {
+                arquivo << "null";
+            }
+        }
+        arquivo << "}, ";
+        
+        const LeituraAlocacoes& alocacoes = resultado.alocacoes;
+        arquivo << "\"alocacoes\": {\"alocacoes\": " << setprecision(1) << alocacoes.alocacoes
+                << ", \"bytes\": " << setprecision(0) << alocacoes.bytesAlocados
+                << ", \"pico_bytes\": " << alocacoes.picoBytes
+                << ", \"rss_max_kb\": " << alocacoes.rssMaximoKb << "}, ";
+        
+        const ContagemOperacoes& operacoes = resultado.operacoes;
+        arquivo << "\"operacoes\": ";
+        if (resultado.operacoesContadas) {
+            arquivo << "{\"comparacoes\": " << operacoes.comparacoes
+                    << ", \"movimentos\": " << operacoes.movimentos
+                    << ", \"trocas\": " << operacoes.trocas
+                    << ", \"profundidade_max\": " << operacoes.profundidadeMaxima
+                    << ", \"fallbacks_heap\": " << operacoes.fallbacksHeapSort
+                    << ", \"folhas_insercao\": " << operacoes.folhasInsercao << "}";
+        } else {
+            arquivo << "null";
+        }
+        arquivo << "}";
     }
+    arquivo << "\n  ]\n}\n";
     
     arquivo.close();
     cout << "Resultados salvos em: " << nomeArquivo << endl;
 }
 
+bool Benchmark::carregarResultados(const string& nomeArquivo,
+                                  vector<ResultadoBenchmark>& resultados,
+                                  vector<pair<string, string>>& ambiente) {
+    ifstream arquivo(nomeArquivo);
+    
+    if (!arquivo.is_open()) {
+        cerr << "Erro ao abrir arquivo de resultados: " << nomeArquivo << endl;
+        return false;
+    }
+    
+    string linha;
+    map<string, size_t> colunas;
+    while (getline(arquivo, linha)) {
+        if (!linha.empty() && linha.back() == '\r') linha.pop_back();
+        if (linha.empty()) continue;
+        
+        if (linha.rfind("# ", 0) == 0) {
+            size_t separador = linha.find(": ");
+            if (separador != string::npos) {
+                ambiente.push_back({linha.substr(2, separador - 2), linha.substr(separador + 2)});
+            }
+            continue;
+        }
+        
+        vector<string> campos = dividirCampos(linha);
+        if (colunas.empty()) {
+            for (size_t c = 0; c < campos.size(); c++) colunas[campos[c]] = c;
+            if (!colunas.count("Algoritmo") || !colunas.count("Tamanho_Array")) {
+                cerr << "Cabeçalho de resultados inválido: " << nomeArquivo << endl;
+                return false;
+            }
+            continue;
+        }
+        
+        // Colunas ausentes (arquivos de versões anteriores) ficam no padrão
+        auto texto = [&](const string& nome) -> string {
+            auto coluna = colunas.find(nome);
+            return coluna != colunas.end() && coluna->second < campos.size()
+                       ? campos[coluna->second] : "";
+        };
+        auto numero = [&](const string& nome) { return strtod(texto(nome).c_str(), nullptr); };
+        
+        ResultadoBenchmark resultado;
+        resultado.nomeAlgoritmo = texto("Algoritmo");
+        resultado.tempoMs = numero("Tempo_ms");
+        resultado.tamanhoArray = strtoull(texto("Tamanho_Array").c_str(), nullptr, 10);
+        resultado.sucesso = texto("Sucesso") == "Sim";
+        resultado.distribuicao = texto("Distribuicao");
+        resultado.extrapolado = texto("Extrapolado") == "Sim";
+        resultado.repeticoes = max(1, static_cast<int>(numero("Repeticoes")));
+        resultado.outliersRemovidos = static_cast<int>(numero("Outliers"));
+        resultado.minimoMs = numero("Min_ms");
+        resultado.medianaMs = colunas.count("Mediana_ms") ? numero("Mediana_ms") : resultado.tempoMs;
+        resultado.mediaMs = numero("Media_ms");
+        resultado.desvioPadraoMs = numero("Desvio_ms");
+        resultado.p95Ms = numero("P95_ms");
+        resultado.icInferiorMs = colunas.count("IC_Inf_ms") ? numero("IC_Inf_ms") : resultado.medianaMs;
+        resultado.icSuperiorMs = colunas.count("IC_Sup_ms") ? numero("IC_Sup_ms") : resultado.medianaMs;
+        resultados.push_back(resultado);
+    }
+    return !colunas.empty();
+}
+
+int Benchmark::compararComLinhaBase(const vector<ResultadoBenchmark>& linhaBase,
+                                   const vector<pair<string, string>>& ambienteBase,
+                                   const vector<ResultadoBenchmark>& atuais,
+                                   const vector<pair<string, string>>& ambienteAtual,
+                                   double tolerancia) {
+    // Tempos de máquinas ou builds diferentes comparam mais que o código
+    auto valor = [](const vector<pair<string, string>>& campos, const string& chave) {
+        for (const auto& campo : campos) {
+            if (campo.first == chave) return campo.second;
+        }
+        return string("desconhecido");
+    };
+    for (const string& chave : AmbienteExecucao::chavesComparaveis()) {
+        string antes = valor(ambienteBase, chave);
+        string depois = valor(ambienteAtual, chave);
+        if (antes != depois) {
+            cout << "Aviso: " << chave << " difere da linha de base (\"" << antes
+                 << "\" -> \"" << depois << "\")" << endl;
+        }
+    }
+    
+    auto chave = [](const ResultadoBenchmark& resultado) {
+        return resultado.nomeAlgoritmo + "|" + to_string(resultado.tamanhoArray) + "|" +
+               resultado.distribuicao;
+    };
+    map<string, const ResultadoBenchmark*> porChave;
+    for (const auto& resultado : linhaBase) {
+        if (resultado.sucesso && !resultado.extrapolado) porChave[chave(resultado)] = &resultado;
+    }
+    
+    cout << "\n=== COMPARAÇÃO COM A LINHA DE BASE (tolerância "
+         << fixed << setprecision(1) << tolerancia * 100 << "%) ===" << endl;
+    cout << left << setw(38) << "Algoritmo" << setw(18) << "Distribuição" << setw(10) << "Tamanho"
+         << setw(14) << "Base (ms)" << setw(14) << "Atual (ms)" << setw(11) << "Razão"
+         << "Status" << endl;
+    cout << string(112, '-') << endl;
+    
+    int regressoes = 0, melhoras = 0, pareados = 0;
+    for (const auto& atual : atuais) {
+        if (!atual.sucesso || atual.extrapolado) continue;
+        auto encontrado = porChave.find(chave(atual));
+        if (encontrado == porChave.end()) continue;
+        const ResultadoBenchmark& base = *encontrado->second;
+        pareados++;
+        
+        // Significativo: a razão das medianas passa da tolerância e os
+        // intervalos de confiança das medianas não se sobrepõem (com uma
+        // repetição o intervalo degenera na própria mediana)
+        double razao = base.medianaMs > 0 ? atual.medianaMs / base.medianaMs : 1.0;
+        string status = "ok";
+        if (razao > 1 + tolerancia && atual.icInferiorMs > base.icSuperiorMs) {
+            status = "REGRESSAO";
+            regressoes++;
+        } else if (razao < 1 / (1 + tolerancia) && atual.icSuperiorMs < base.icInferiorMs) {
+            status = "melhora";
+            melhoras++;
+        }
+        
+        cout << left << setw(38) << atual.nomeAlgoritmo
+             << setw(16) << (atual.distribuicao.empty() ? "-" : atual.distribuicao)
+             << setw(10) << atual.tamanhoArray
+             << setw(14) << setprecision(3) << base.medianaMs
+             << setw(14) << atual.medianaMs
+             << setw(10) << setprecision(2) << razao
+             << status << endl;
+    }
+    
+    cout << "\nPareados: " << pareados << ", regressões: " << regressoes
+         << ", melhoras: " << melhoras << endl;
+    if (pareados == 0) {
+        cout << "Aviso: nenhum resultado corresponde à linha de base "
+                "(algoritmo, tamanho e distribuição)" << endl;
+    }
+    return regressoes;
+}
+
 void Benchmark::imprimirResultados(const vector<ResultadoBenchmark>& resultados) {
     cout << "\n=== RESULTADOS DO BENCHMARK ===" << endl;
-    cout << left << setw(20) << "Algoritmo" 
-         << setw(15) << "Tempo (ms)" 
-         << setw(15) << "Tamanho" 
+    cout << left << setw(38) << "Algoritmo" 
+         << setw(15) << "Mediana (ms)" 
+         << setw(24) << "IC 95% (ms)" 
+         << setw(12) << "Desvio" 
+         << setw(8) << "Reps" 
+         << setw(12) << "Tamanho" 
          << setw(10) << "Status" << endl;
-    cout << string(60, '-') << endl;
+    cout << string(119, '-') << endl;
     
     for (const auto& resultado : resultados) {
-        cout << left << setw(20) << resultado.nomeAlgoritmo
+        ostringstream intervalo;
+        intervalo << fixed << setprecision(3) << "[" << resultado.icInferiorMs << ", "
+                  << resultado.icSuperiorMs << "]";
+        
+        cout << left << setw(38) << resultado.nomeAlgoritmo
              << setw(15) << fixed << setprecision(3) << resultado.tempoMs
-             << setw(15) << resultado.tamanhoArray
-             << setw(10) << (resultado.sucesso ? "OK" : "ERRO") << endl;
+             << setw(24) << intervalo.str()
+             << setw(12) << resultado.desvioPadraoMs
+             << setw(8) << resultado.repeticoes
+             << setw(12) << resultado.tamanhoArray
+             << setw(10) << (resultado.extrapolado ? "EXTRAP" : resultado.sucesso ? "OK" : "ERRO")
+             << endl;
     }
     
-    // Encontra o mais rápido
+    // Encontra o mais rápido (pela mediana)
+    auto candidato = [](const ResultadoBenchmark& resultado) {
+        return resultado.sucesso && resultado.concorre;
+    };
     auto melhor = min_element(resultados.begin(), resultados.end(),
-        [](const ResultadoBenchmark& a, const ResultadoBenchmark& b) {
-            return a.sucesso && (!b.sucesso || a.tempoMs < b.tempoMs);
+        [&](const ResultadoBenchmark& a, const ResultadoBenchmark& b) {
+            return candidato(a) && (!candidato(b) || a.tempoMs < b.tempoMs);
         });
     
-    if (melhor != resultados.end() && melhor->sucesso) {
+    // Com um só candidato não há o que escolher
+    if (count_if(resultados.begin(), resultados.end(), candidato) > 1) {
         cout << "\nMelhor algoritmo: " << melhor->nomeAlgoritmo 
              << " (" << melhor->tempoMs << " ms)" << endl;
+        
+        // Intervalos que se sobrepõem ao do melhor no mesmo tamanho: a
+        // diferença não é estatisticamente distinguível
+        for (const auto& resultado : resultados) {
+            if (&resultado == &*melhor || !candidato(resultado) ||
+                resultado.tamanhoArray != melhor->tamanhoArray) continue;
+            if (resultado.icInferiorMs <= melhor->icSuperiorMs) {
+                cout << "Empate estatístico com: " << resultado.nomeAlgoritmo
+                     << " (" << resultado.tempoMs << " ms)" << endl;
+            }
+        }
     }
     
+    imprimirContadores(resultados);
+    imprimirAlocacoes(resultados);
+    imprimirOperacoes(resultados);
+    
     cout << "================================" << endl;
 }
 
+void Benchmark::imprimirContadores(const vector<ResultadoBenchmark>& resultados) {
+    bool algum = false;
+    for (const auto& resultado : resultados) algum = algum || resultado.contadores.algumDisponivel();
+    
+    if (!algum) {
+        cout << "\nContadores de hardware indisponíveis (perf_event_open)" << endl;
+        return;
+    }
+    
+    cout << "\n=== CONTADORES DE HARDWARE (média por execução) ===" << endl;
+    cout << left << setw(38) << "Algoritmo" << setw(12) << "Tamanho" << setw(8) << "IPC";
+    for (int e = 0; e < NUM_EVENTOS; e++) cout << setw(14) << ContadoresHardware::nomeEvento(e);
+    cout << endl;
+    cout << string(58 + 14 * NUM_EVENTOS, '-') << endl;
+    
+    for (const auto& resultado : resultados) {
+        const LeituraContadores& contadores = resultado.contadores;
+        if (!contadores.algumDisponivel()) continue;
+        
+        cout << left << setw(38) << resultado.nomeAlgoritmo
+             << setw(12) << resultado.tamanhoArray
+             << setw(8) << fixed << setprecision(2) << contadores.ipc() << setprecision(0);
+        for (int e = 0; e < NUM_EVENTOS; e++) {
+            if (contadores.disponivel[e]) cout << setw(14) << contadores.valores[e];
+            else cout << setw(14) << "-";
+        }
+        cout << endl;
+    }
+    cout << setprecision(3);
+}
+
+void Benchmark::imprimirAlocacoes(const vector<ResultadoBenchmark>& resultados) {
+    cout << "\n=== MEMÓRIA NA REGIÃO CRONOMETRADA (por execução) ===" << endl;
+    cout << left << setw(38) << "Algoritmo" << setw(12) << "Tamanho" << setw(14) << "Alocações"
+         << setw(16) << "Alocado (KB)" << setw(14) << "Pico (KB)" << setw(14) << "RSS máx (MB)"
+         << endl;
+    cout << string(108, '-') << endl;
+    
+    for (const auto& resultado : resultados) {
+        const LeituraAlocacoes& alocacoes = resultado.alocacoes;
+        cout << left << setw(38) << resultado.nomeAlgoritmo
+             << setw(12) << resultado.tamanhoArray
+             << setw(14) << fixed << setprecision(1) << alocacoes.alocacoes
+             << setw(16) << alocacoes.bytesAlocados / 1024.0
+             << setw(14) << alocacoes.picoBytes / 1024.0
+             << setw(14) << alocacoes.rssMaximoKb / 1024.0 << endl;
+    }
+    cout << setprecision(3);
+}
+
+void Benchmark::imprimirOperacoes(const vector<ResultadoBenchmark>& resultados) {
+    bool alguma = false;
+    for (const auto& resultado : resultados) alguma = alguma || resultado.operacoesContadas;
+    if (!alguma) return;
+    
+    cout << "\n=== CONTAGEM DE OPERAÇÕES ===" << endl;
+    cout << left << setw(24) << "Algoritmo" << setw(10) << "Tamanho" << setw(15) << "Comparações"
+         << setw(15) << "Movimentos" << setw(13) << "Trocas" << setw(7) << "Prof."
+         << setw(7) << "Heap" << setw(9) << "Folhas" << setw(12) << "C/nlog2n"
+         << setw(12) << "C/n²" << setw(10) << "Expoente" << "Crescimento" << endl;
+    cout << string(146, '-') << endl;
+    
+    for (const auto& resultado : resultados) {
+        if (!resultado.operacoesContadas) continue;
+        const ContagemOperacoes& operacoes = resultado.operacoes;
+        double n = resultado.tamanhoArray;
+        double comparacoes = static_cast<double>(operacoes.comparacoes);
+        
+        // Tamanho anterior mais próximo do mesmo algoritmo e distribuição:
+        // C ~ n^k dá k ~ 1 para n log n e k ~ 2 para n²
+        const ResultadoBenchmark* anterior = nullptr;
+        for (const auto& outro : resultados) {
+            if (!outro.operacoesContadas || outro.nomeAlgoritmo != resultado.nomeAlgoritmo ||
+                outro.distribuicao != resultado.distribuicao ||
+                outro.tamanhoArray >= resultado.tamanhoArray) continue;
+            if (!anterior || outro.tamanhoArray > anterior->tamanhoArray) anterior = &outro;
+        }
+        
+        cout << left << setw(24) << resultado.nomeAlgoritmo << setw(10) << resultado.tamanhoArray
+             << setw(15) << operacoes.comparacoes << setw(15) << operacoes.movimentos
+             << setw(13) << operacoes.trocas << setw(7) << operacoes.profundidadeMaxima
+             << setw(7) << operacoes.fallbacksHeapSort << setw(9) << operacoes.folhasInsercao
+             << fixed << setprecision(3)
+             << setw(12) << (n > 1 ? comparacoes / (n * log2(n)) : 0.0)
+             << setw(12) << (n > 0 ? comparacoes / (n * n) : 0.0);
+        
+        if (anterior && anterior->operacoes.comparacoes > 0 && comparacoes > 0) {
+            double expoente = log(comparacoes / anterior->operacoes.comparacoes) /
+                              log(n / anterior->tamanhoArray);
+            cout << setw(10) << setprecision(2) << expoente << (expoente > 1.5 ? "~n²" : "~n log n");
+        } else {
+            cout << setw(10) << "-" << "-";
+        }
+        cout << endl;
+    }
+    cout << setprecision(3);
+}
+
 bool Benchmark::verificarOrdenacao(const vector<double>& arr) {
     for (size_t i = 1; i < arr.size(); i++) {
         if (arr[i] < arr[i-1]) {
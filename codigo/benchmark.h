@@ -5,33 +5,240 @@
 #include <string>
 #include <chrono>
 #include <functional>
+#include "tabela_colunas.h"
+#include "ordenacao_multichave.h"
+#include "contadores_hardware.h"
+#include "contador_alocacoes.h"
+#include "contagem_operacoes.h"
+#include "gerador_distribuicoes.h"
+#include "coluna_texto.h"
+#include "coluna_celulas.h"
+#include "despacho_ordenacao.h"
 
 using namespace std;
 using namespace chrono;
 
 struct ResultadoBenchmark {
     string nomeAlgoritmo;
-    double tempoMs;
-    int tamanhoArray;
+    double tempoMs;             // mediana das repetições
+    size_t tamanhoArray;
     bool sucesso;
+    string distribuicao;        // entrada sintética; vazio para dados reais
+    bool extrapolado = false;   // estimado pela curva ajustada, não medido
+    bool concorre = true;       // entra na escolha do melhor algoritmo
+    
+    // Distribuição das repetições (após remoção de outliers)
+    int repeticoes = 1;
+    int outliersRemovidos = 0;
+    double minimoMs = 0;
+    double medianaMs = 0;
+    double mediaMs = 0;
+    double desvioPadraoMs = 0;
+    double p95Ms = 0;
+    double icInferiorMs = 0;    // intervalo de confiança da mediana (bootstrap)
+    double icSuperiorMs = 0;
+    
+    // Média por repetição dos contadores de hardware (perf_event_open)
+    LeituraContadores contadores;
+    
+    // Alocações e bytes: média por repetição; picos: máximo das repetições
+    LeituraAlocacoes alocacoes;
+    
+    // Operações de uma execução extra, fora da medição (só nos núcleos
+    // instrumentados pela política de contagem)
+    ContagemOperacoes operacoes;
+    bool operacoesContadas = false;
+};
+
+struct ConfiguracaoMedicao {
+    int aquecimento = 1;        // execuções descartadas antes das medidas
+    int repeticoes = 5;
+    bool removerOutliers = true;   // cercas de Tukey (1.5 x IQR)
+    int reamostragensBootstrap = 1000;
+    double nivelConfianca = 0.95;
+    int cpuFixa = -1;           // -1: não fixa o processo em uma CPU
+    bool contadoresHardware = true;
+};
+
+struct AlgoritmoRegistrado {
+    string nome;
+    function<void(vector<double>&)> ordenar;
+    // Versão instrumentada; vazia quando o algoritmo não tem contagem
+    function<void(vector<double>&, ContagemOperacoes&)> contar = nullptr;
 };
 
 class Benchmark {
 public:
-    static ResultadoBenchmark medirTempo(const string& nome, vector<double> dados, 
+    // Vale para todas as medições seguintes; fixa o processo na CPU pedida
+    static void configurarMedicao(const ConfiguracaoMedicao& configuracao);
+    static const ConfiguracaoMedicao& configuracaoMedicao();
+    
+    // Aquecimento + repetições, cada uma sobre uma cópia nova dos dados
+    // feita fora da região cronometrada
+    static ResultadoBenchmark medirTempo(const string& nome, const vector<double>& dados, 
                                        function<void(vector<double>&)> algoritmo);
     
+    // Algoritmos sobre vector<double>, na ordem em que são medidos
+    static const vector<AlgoritmoRegistrado>& algoritmosRegistrados();
+    
+    // selecionados vazio = todos os algoritmos
     static void executarBenchmarkCompleto(const vector<double>& dados, 
-                                        vector<ResultadoBenchmark>& resultados);
+                                        vector<ResultadoBenchmark>& resultados,
+                                        const vector<string>& selecionados = {});
+    
+    // Varredura algoritmo x distribuição x tamanho sobre entradas sintéticas
+    // reprodutíveis (mesma semente para todas as distribuições).
+    // Com orcamentoMs > 0 cada algoritmo roda num processo filho vigiado:
+    // se uma ordenação passar do orçamento (ou o filho for morto pelo
+    // vigia), o algoritmo sai dos tamanhos maiores, que recebem um tempo
+    // extrapolado pela curva t = a n^b ajustada aos pontos já medidos.
+    static void executarVarreduraDistribuicoes(const vector<Distribuicao>& distribuicoes,
+                                             const vector<size_t>& tamanhos,
+                                             const vector<string>& selecionados,
+                                             uint64_t semente,
+                                             vector<ResultadoBenchmark>& resultados,
+                                             double orcamentoMs = 0);
+    
+    // Autoajuste no host, sobre entradas sintéticas: varre limiar da folha
+    // x fator de profundidade do introsort ajustado e, por tamanho, o
+    // algoritmo mais rápido do despacho. Critério: média geométrica das medianas. Deixa a
+    // configuração ativa e a devolve para ser gravada no arquivo de ajuste.
+    static ConfiguracaoDespacho executarAutoajuste(const vector<Distribuicao>& distribuicoes,
+                                                 const vector<size_t>& tamanhos, uint64_t semente,
+                                                 vector<ResultadoBenchmark>& resultados);
+    
+    // Ordenação de linhas por várias chaves: comparador lexicográfico x
+    // chaves compostas empacotadas em inteiros
+    static void executarBenchmarkMultiChave(const TabelaColunas& tabela,
+                                          const vector<ChaveOrdenacao>& chaves,
+                                          vector<ResultadoBenchmark>& resultados);
+    
+    // Ordenação de um intervalo inteiro da planilha: argsort da coluna-chave
+    // e reordenação de 20 colunas de carga (gather, gather em blocos,
+    // ciclos in-place, paralelo) contra o stable_sort das linhas como structs
+    static void executarBenchmarkPermutacao(const TabelaColunas& tabela, size_t colunaChave,
+                                          vector<ResultadoBenchmark>& resultados);
+    
+    // Coluna já ordenada + lote de valores acrescentados ou alterados:
+    // reordenação incremental x Power Sort x Introsort completo
+    static void executarBenchmarkIncremental(const vector<double>& dados, size_t tamanhoLote,
+                                           vector<ResultadoBenchmark>& resultados);
+    
+    // Seleção dos k menores para vários k: Partial Sort, nth_element
+    // (introselect) e top-k em fluxo contra o Introsort do array inteiro
+    static void executarBenchmarkTopK(const vector<double>& dados, const vector<size_t>& ks,
+                                    vector<ResultadoBenchmark>& resultados);
+    
+    // Coluna de texto nos tamanhos pedidos: std::sort das visões, multikey
+    // quicksort e MSD radix em ordem de bytes e, para cada nível de
+    // colação, a geração das chaves e a ordenação completa por elas
+    static void executarBenchmarkTexto(const ColunaTexto& coluna, const vector<size_t>& tamanhos,
+                                     vector<ResultadoBenchmark>& resultados);
+    
+    // Coluna mista (números, textos, erros, vazias) na ordem do Calc, em
+    // ordem crescente e decrescente: partição por tipo + núcleo de cada
+    // tipo contra um único comparador sobre variant
+    static void executarBenchmarkCelulas(const ColunaCelulas& coluna, const vector<size_t>& tamanhos,
+                                       vector<ResultadoBenchmark>& resultados);
     
+    // Ordenação externa de um arquivo binário bruto de doubles com
+    // orçamento de memória limitado (runs + merge k-way em disco),
+    // seguida da seleção em fluxo dos k menores do mesmo arquivo
+    static void executarBenchmarkExterno(const string& arquivoEntrada, size_t memoriaBytes,
+                                       vector<ResultadoBenchmark>& resultados,
+                                       size_t kTopK = 100);
+    
+    // CSV com a procedência (AmbienteExecucao e configuração de medição)
+    // em linhas "# chave: valor" antes do cabeçalho
     static void salvarResultados(const vector<ResultadoBenchmark>& resultados, 
                                const string& nomeArquivo);
     
+    // Mesmo conteúdo em JSON: {"ambiente": {...}, "resultados": [...]}
+    static void salvarResultadosJSON(const vector<ResultadoBenchmark>& resultados,
+                                   const string& nomeArquivo);
+    
+    // Lê um CSV gravado por salvarResultados (tempos e estatísticas; os
+    // contadores não são lidos) e a procedência dos comentários
+    static bool carregarResultados(const string& nomeArquivo,
+                                 vector<ResultadoBenchmark>& resultados,
+                                 vector<pair<string, string>>& ambiente);
+    
+    // Pareia por algoritmo, tamanho e distribuição e devolve quantos
+    // resultados ficaram significativamente mais lentos: mediana acima de
+    // (1 + tolerancia) x a da linha de base e ICs sem sobreposição.
+    // Avisa quando compilador, flags ou CPU diferem entre as execuções.
+    static int compararComLinhaBase(const vector<ResultadoBenchmark>& linhaBase,
+                                  const vector<pair<string, string>>& ambienteBase,
+                                  const vector<ResultadoBenchmark>& atuais,
+                                  const vector<pair<string, string>>& ambienteAtual,
+                                  double tolerancia);
+    
     static void imprimirResultados(const vector<ResultadoBenchmark>& resultados);
     
     static bool verificarOrdenacao(const vector<double>& arr);
 
 private:
+    // Introsort genérico com a coluna convertida para int64 e int32
+    // (apenas quando todos os valores são inteiros, como em CÓDIGO)
+    static void executarBenchmarkTiposChave(const vector<double>& dados,
+                                          vector<ResultadoBenchmark>& resultados,
+                                          const vector<string>& selecionados);
+    
+    // Medição de um algoritmo registrado (mais a contagem de operações,
+    // quando ele tem versão instrumentada)
+    static ResultadoBenchmark medirAlgoritmo(const AlgoritmoRegistrado& algoritmo,
+                                           const vector<double>& dados);
+    
+    // medirAlgoritmo num processo filho (fork) com vigia: falso se o filho
+    // não terminar em limiteMs ou morrer antes de devolver o resultado
+    static bool medirEmProcessoFilho(const AlgoritmoRegistrado& algoritmo,
+                                     const vector<double>& dados, double limiteMs,
+                                     ResultadoBenchmark& resultado);
+    
+    // Tempo em n pela curva t = a n^b ajustada (mínimos quadrados em
+    // log-log) aos pontos medidos (n, t); com um só ponto, b = 1
+    static double extrapolarTempo(const vector<pair<double, double>>& pontos, double n);
+    
+    template <class T, class Algoritmo>
+    static ResultadoBenchmark medirTempoTipado(const string& nome, const vector<T>& dados,
+                                              Algoritmo algoritmo);
+    
+    // Como medirTempoTipado, mas o resultado de cada repetição é validado
+    // por verificador(trabalho) em vez de exigir o array todo ordenado
+    template <class T, class Algoritmo, class Verificador>
+    static ResultadoBenchmark medirTempoVerificado(const string& nome, const vector<T>& dados,
+                                                  Algoritmo algoritmo, Verificador verificador);
+    
+    // Para o que não é um vector ordenado no lugar (tabelas, textos,
+    // células, arquivos): mede executar() com preparar() fora da região,
+    // resume as amostras e confere o estado final uma vez com verificar()
+    template <class Preparar, class Executar, class Verificar>
+    static ResultadoBenchmark medirRegiao(const string& nome, size_t tamanho, Preparar preparar,
+                                          Executar executar, Verificar verificar);
+    
+    // Roda preparar() fora e executar() dentro da região cronometrada,
+    // devolvendo os tempos (ms) das repetições após o aquecimento e, se
+    // pedido, os contadores de hardware e as alocações nessas repetições
+    template <class Preparar, class Executar>
+    static vector<double> coletarAmostras(Preparar preparar, Executar executar,
+                                          LeituraContadores* contadores = nullptr,
+                                          LeituraAlocacoes* alocacoes = nullptr);
+    
+    // Mínimo, mediana, média, desvio, p95 e IC bootstrap das amostras
+    static void resumirAmostras(vector<double> amostras, ResultadoBenchmark& resultado);
+    
+    static ConfiguracaoMedicao configuracao;
+    
+    static void imprimirMatrizDistribuicoes(const vector<ResultadoBenchmark>& resultados);
+    
+    static void imprimirContadores(const vector<ResultadoBenchmark>& resultados);
+    
+    static void imprimirAlocacoes(const vector<ResultadoBenchmark>& resultados);
+    
+    // Contagens normalizadas por n log2 n e n², com o expoente de
+    // crescimento entre tamanhos consecutivos do mesmo algoritmo
+    static void imprimirOperacoes(const vector<ResultadoBenchmark>& resultados);
+    
     static string formatarTempo(double tempoMs);
 };
 
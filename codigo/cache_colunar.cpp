@@ -0,0 +1,181 @@
+#include "cache_colunar.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace std;
+
+static const char MAGICA_CACHE[8] = {'C', 'O', 'L', 'B', 'I', 'N', '\0', '\0'};
+static const uint64_t ALINHAMENTO_DADOS = 64;
+
+ColunaMapeada::ColunaMapeada(ColunaMapeada&& outra) noexcept {
+    *this = move(outra);
+}
+
+ColunaMapeada& ColunaMapeada::operator=(ColunaMapeada&& outra) noexcept {
+    if (this != &outra) {
+        liberar();
+        mapa = outra.mapa;
+        tamanhoMapa = outra.tamanhoMapa;
+        dados = outra.dados;
+        quantidade = outra.quantidade;
+        outra.mapa = nullptr;
+        outra.dados = nullptr;
+        outra.tamanhoMapa = outra.quantidade = 0;
+    }
+    return *this;
+}
+
+ColunaMapeada::~ColunaMapeada() {
+    liberar();
+}
+
+void ColunaMapeada::liberar() {
+    if (mapa) munmap(mapa, tamanhoMapa);
+    mapa = nullptr;
+    dados = nullptr;
+    tamanhoMapa = quantidade = 0;
+}
+
+// Mistura de 64 bits por palavra (estilo splitmix64): rápida o bastante
+// para percorrer a planilha inteira a cada execução
+bool CacheColunar::hashArquivo(const string& nomeArquivo, uint64_t& hash) {
+    int fd = open(nomeArquivo.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+    
+    struct stat info;
+    if (fstat(fd, &info) != 0) {
+        close(fd);
+        return false;
+    }
+    
+    size_t tamanho = info.st_size;
+    hash = 0x9E3779B97F4A7C15ULL ^ tamanho;
+    if (tamanho == 0) {
+        close(fd);
+        return true;
+    }
+    
+    void* mapa = mmap(nullptr, tamanho, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapa == MAP_FAILED) return false;
+    madvise(mapa, tamanho, MADV_SEQUENTIAL);
+    
+    auto misturar = [](uint64_t h, uint64_t palavra) {
+        h ^= palavra + 0x9E3779B97F4A7C15ULL + (h << 6) + (h >> 2);
+        h ^= h >> 30;
+        h *= 0xBF58476D1CE4E5B9ULL;
+        h ^= h >> 27;
+        return h;
+    };
+    
+    const unsigned char* bytes = static_cast<const unsigned char*>(mapa);
+    size_t i = 0;
+    for (; i + 8 <= tamanho; i += 8) {
+        uint64_t palavra;
+        memcpy(&palavra, bytes + i, 8);
+        hash = misturar(hash, palavra);
+    }
+    uint64_t resto = 0;
+    memcpy(&resto, bytes + i, tamanho - i);
+    hash = misturar(hash, resto);
+    
+    munmap(mapa, tamanho);
+    return true;
+}
+
+string CacheColunar::caminhoCache(const string& origem, int coluna) {
+    return origem + ".col" + to_string(coluna) + ".colbin";
+}
+
+bool CacheColunar::gravar(const string& nomeArquivo, const vector<double>& dados,
+                          uint64_t hashOrigem, int coluna) {
+    CabecalhoCache cabecalho = {};
+    memcpy(cabecalho.magica, MAGICA_CACHE, sizeof(MAGICA_CACHE));
+    cabecalho.versao = VERSAO;
+    cabecalho.tipo = TIPO_DOUBLE;
+    cabecalho.quantidade = dados.size();
+    cabecalho.hashOrigem = hashOrigem;
+    cabecalho.coluna = coluna;
+    cabecalho.deslocamentoDados =
+        (sizeof(CabecalhoCache) + ALINHAMENTO_DADOS - 1) / ALINHAMENTO_DADOS * ALINHAMENTO_DADOS;
+    
+    // Estatísticas calculadas uma única vez, na criação do cache
+    if (!dados.empty()) {
+        double soma = 0;
+        cabecalho.minimo = cabecalho.maximo = dados[0];
+        for (double valor : dados) {
+            cabecalho.minimo = min(cabecalho.minimo, valor);
+            cabecalho.maximo = max(cabecalho.maximo, valor);
+            soma += valor;
+        }
+        cabecalho.media = soma / dados.size();
+    }
+    
+    // Grava em arquivo temporário e renomeia, para nunca deixar cache parcial
+    string temporario = nomeArquivo + ".tmp";
+    ofstream arquivo(temporario, ios::binary);
+    if (!arquivo.is_open()) {
+        cerr << "Erro ao criar cache: " << nomeArquivo << endl;
+        return false;
+    }
+    
+    vector<char> preenchimento(cabecalho.deslocamentoDados - sizeof(CabecalhoCache), 0);
+    arquivo.write(reinterpret_cast<const char*>(&cabecalho), sizeof(cabecalho));
+    arquivo.write(preenchimento.data(), preenchimento.size());
+    arquivo.write(reinterpret_cast<const char*>(dados.data()), dados.size() * sizeof(double));
+    arquivo.close();
+    
+    if (!arquivo || rename(temporario.c_str(), nomeArquivo.c_str()) != 0) {
+        cerr << "Erro ao gravar cache: " << nomeArquivo << endl;
+        remove(temporario.c_str());
+        return false;
+    }
+    return true;
+}
+
+ColunaMapeada CacheColunar::abrir(const string& nomeArquivo, uint64_t hashOrigem, int coluna) {
+    ColunaMapeada resultado;
+    
+    int fd = open(nomeArquivo.c_str(), O_RDONLY);
+    if (fd < 0) return resultado;
+    
+    struct stat info;
+    if (fstat(fd, &info) != 0 || static_cast<size_t>(info.st_size) < sizeof(CabecalhoCache)) {
+        close(fd);
+        return resultado;
+    }
+    
+    size_t tamanho = info.st_size;
+    void* mapa = mmap(nullptr, tamanho, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapa == MAP_FAILED) return resultado;
+    
+    const CabecalhoCache* cabecalho = static_cast<const CabecalhoCache*>(mapa);
+    bool compativel = memcmp(cabecalho->magica, MAGICA_CACHE, sizeof(MAGICA_CACHE)) == 0 &&
+                      cabecalho->versao == VERSAO && cabecalho->tipo == TIPO_DOUBLE &&
+                      cabecalho->hashOrigem == hashOrigem && cabecalho->coluna == coluna &&
+                      cabecalho->deslocamentoDados % sizeof(double) == 0 &&
+                      cabecalho->deslocamentoDados >= sizeof(CabecalhoCache) &&
+                      cabecalho->deslocamentoDados <= tamanho &&
+                      // Sem multiplicar: quantidade vem do arquivo e poderia estourar
+                      cabecalho->quantidade <= (tamanho - cabecalho->deslocamentoDados) / sizeof(double);
+    
+    if (!compativel) {
+        munmap(mapa, tamanho);
+        return resultado;
+    }
+    
+    resultado.mapa = mapa;
+    resultado.tamanhoMapa = tamanho;
+    resultado.dados = reinterpret_cast<const double*>(static_cast<const char*>(mapa) +
+                                                      cabecalho->deslocamentoDados);
+    resultado.quantidade = cabecalho->quantidade;
+    return resultado;
+}
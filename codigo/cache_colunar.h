@@ -0,0 +1,80 @@
+#ifndef CACHE_COLUNAR_H
+#define CACHE_COLUNAR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+// Cabeçalho do formato binário colunar (.colbin). Os dados começam em
+// deslocamentoDados (alinhado a 64 bytes) e são lidos via mmap, sem parsing.
+struct CabecalhoCache {
+    char magica[8];
+    uint32_t versao;
+    uint32_t tipo;
+    uint64_t quantidade;
+    double minimo;
+    double maximo;
+    double media;
+    uint64_t hashOrigem;
+    int32_t coluna;
+    uint32_t reservado;
+    uint64_t deslocamentoDados;
+};
+
+// Visão somente leitura de uma coluna mapeada em memória (apenas movível)
+class ColunaMapeada {
+public:
+    ColunaMapeada() = default;
+    ColunaMapeada(ColunaMapeada&& outra) noexcept;
+    ColunaMapeada& operator=(ColunaMapeada&& outra) noexcept;
+    ~ColunaMapeada();
+
+    ColunaMapeada(const ColunaMapeada&) = delete;
+    ColunaMapeada& operator=(const ColunaMapeada&) = delete;
+
+    bool valida() const { return mapa != nullptr; }
+    const CabecalhoCache& cabecalho() const { return *static_cast<const CabecalhoCache*>(mapa); }
+
+    const double* data() const { return dados; }
+    size_t size() const { return quantidade; }
+    bool empty() const { return quantidade == 0; }
+    const double* begin() const { return dados; }
+    const double* end() const { return dados + quantidade; }
+    double operator[](size_t i) const { return dados[i]; }
+
+private:
+    friend class CacheColunar;
+
+    void* mapa = nullptr;
+    size_t tamanhoMapa = 0;
+    const double* dados = nullptr;
+    size_t quantidade = 0;
+
+    void liberar();
+};
+
+class CacheColunar {
+public:
+    static const uint32_t VERSAO = 1;
+    static const uint32_t TIPO_DOUBLE = 1;
+
+    // Hash do conteúdo do arquivo de origem (CSV/XLSX), lido via mmap.
+    // Retorna false se o arquivo não puder ser aberto ou mapeado.
+    static bool hashArquivo(const string& nomeArquivo, uint64_t& hash);
+
+    // Caminho do cache ao lado da origem: <origem>.col<coluna>.colbin
+    static string caminhoCache(const string& origem, int coluna);
+
+    // Grava a coluna com estatísticas (mínimo, máximo, média) no cabeçalho
+    static bool gravar(const string& nomeArquivo, const vector<double>& dados,
+                       uint64_t hashOrigem, int coluna);
+
+    // Mapeia o cache; retorna uma coluna inválida se o arquivo não existir,
+    // estiver corrompido ou tiver sido gerado de outra versão da origem
+    static ColunaMapeada abrir(const string& nomeArquivo, uint64_t hashOrigem, int coluna);
+};
+
+#endif
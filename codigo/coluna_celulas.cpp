@@ -0,0 +1,157 @@
+#include "coluna_celulas.h"
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstring>
+
+using namespace std;
+
+namespace {
+
+// Códigos de erro do Calc e do Excel reconhecidos na importação
+const char* const CODIGOS_ERRO[] = {"#N/A", "#DIV/0!", "#VALUE!", "#REF!", "#NAME?",
+                                    "#NUM!", "#NULL!", "#NV", "#VALOR!", "#NOME?"};
+
+bool ehErro(string_view campo) {
+    if (campo.rfind("Err:", 0) == 0) return campo.size() > 4;
+    for (const char* codigo : CODIGOS_ERRO) {
+        if (campo == codigo) return true;
+    }
+    return false;
+}
+
+uint64_t bitsDe(double valor) {
+    uint64_t bits;
+    memcpy(&bits, &valor, sizeof(bits));
+    return bits;
+}
+
+}
+
+void ColunaCelulas::adicionarNumero(double valor) {
+    if (std::isnan(valor)) {
+        adicionarErro("#NUM!");
+        return;
+    }
+    tiposCelulas.push_back(TipoCelula::Numero);
+    cargas.push_back(bitsDe(valor));
+}
+
+void ColunaCelulas::adicionarTexto(string_view texto) {
+    tiposCelulas.push_back(TipoCelula::Texto);
+    cargas.push_back(textosCelulas.size());
+    textosCelulas.adicionar(texto);
+}
+
+void ColunaCelulas::adicionarErro(string_view codigo) {
+    tiposCelulas.push_back(TipoCelula::Erro);
+    cargas.push_back(errosCelulas.size());
+    errosCelulas.adicionar(codigo);
+}
+
+void ColunaCelulas::adicionarVazia() {
+    tiposCelulas.push_back(TipoCelula::Vazia);
+    cargas.push_back(0);
+}
+
+void ColunaCelulas::adicionarCampo(string_view campo) {
+    size_t inicio = campo.find_first_not_of(" \t");
+    if (inicio == string_view::npos) {
+        adicionarVazia();
+        return;
+    }
+    size_t fim = campo.find_last_not_of(" \t\r");
+    string_view aparado = campo.substr(inicio, fim - inicio + 1);
+
+    // inf e nan são texto para o Calc
+    double valor;
+    const char* primeiro = aparado.data() + (aparado[0] == '+' ? 1 : 0);
+    const char* ultimo = aparado.data() + aparado.size();
+    auto resultado = from_chars(primeiro, ultimo, valor);
+    if (primeiro < ultimo && resultado.ec == errc() && resultado.ptr == ultimo && std::isfinite(valor)) {
+        adicionarNumero(valor);
+    } else if (ehErro(aparado)) {
+        adicionarErro(aparado);
+    } else {
+        adicionarTexto(campo);
+    }
+}
+
+size_t ColunaCelulas::contar(TipoCelula tipoProcurado) const {
+    size_t total = 0;
+    for (TipoCelula atual : tiposCelulas) total += atual == tipoProcurado;
+    return total;
+}
+
+double ColunaCelulas::numero(size_t i) const {
+    double valor;
+    memcpy(&valor, &cargas[i], sizeof(valor));
+    return valor;
+}
+
+string_view ColunaCelulas::texto(size_t i) const {
+    if (tiposCelulas[i] == TipoCelula::Texto) return textosCelulas[cargas[i]];
+    if (tiposCelulas[i] == TipoCelula::Erro) return errosCelulas[cargas[i]];
+    return string_view();
+}
+
+ColunaCelulas ColunaCelulas::prefixo(size_t n) const {
+    ColunaCelulas copia;
+    copia.nome = nome;
+    n = min(n, size());
+    for (size_t i = 0; i < n; i++) {
+        switch (tiposCelulas[i]) {
+            case TipoCelula::Numero: copia.adicionarNumero(numero(i)); break;
+            case TipoCelula::Texto: copia.adicionarTexto(texto(i)); break;
+            case TipoCelula::Erro: copia.adicionarErro(texto(i)); break;
+            case TipoCelula::Vazia: copia.adicionarVazia(); break;
+        }
+    }
+    return copia;
+}
+
+void ColunaCelulas::aplicarPermutacao(const vector<size_t>& permutacao) {
+    vector<TipoCelula> novosTipos(permutacao.size());
+    vector<uint64_t> novasCargas(permutacao.size());
+    for (size_t i = 0; i < permutacao.size(); i++) {
+        novosTipos[i] = tiposCelulas[permutacao[i]];
+        novasCargas[i] = cargas[permutacao[i]];
+    }
+    tiposCelulas.swap(novosTipos);
+    cargas.swap(novasCargas);
+}
+
+void ColunaCelulas::reconstruir(const vector<double>& numeros, const vector<size_t>& ordemTextos,
+                                const vector<size_t>& ordemErros, size_t vazias, bool crescente) {
+    size_t total = numeros.size() + ordemTextos.size() + ordemErros.size() + vazias;
+    tiposCelulas.resize(total);
+    cargas.resize(total);
+
+    size_t i = 0;
+    auto escreverNumeros = [&]() {
+        for (double valor : numeros) {
+            tiposCelulas[i] = TipoCelula::Numero;
+            cargas[i++] = bitsDe(valor);
+        }
+    };
+    auto escreverLinhas = [&](const vector<size_t>& linhas, TipoCelula tipoSegmento) {
+        for (size_t linha : linhas) {
+            tiposCelulas[i] = tipoSegmento;
+            cargas[i++] = linha;
+        }
+    };
+
+    if (crescente) {
+        escreverNumeros();
+        escreverLinhas(ordemTextos, TipoCelula::Texto);
+        escreverLinhas(ordemErros, TipoCelula::Erro);
+    } else {
+        escreverLinhas(ordemErros, TipoCelula::Erro);
+        escreverLinhas(ordemTextos, TipoCelula::Texto);
+        escreverNumeros();
+    }
+    for (; i < total; i++) {
+        tiposCelulas[i] = TipoCelula::Vazia;
+        cargas[i] = 0;
+    }
+}
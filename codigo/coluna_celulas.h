@@ -0,0 +1,70 @@
+#ifndef COLUNA_CELULAS_H
+#define COLUNA_CELULAS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "coluna_texto.h"
+
+using namespace std;
+
+// Tipos de célula na ordem crescente do Calc: números, depois textos,
+// depois erros; vazias sempre no fim (também na ordem decrescente).
+// Lógicos são números (0/1), como no Calc.
+enum class TipoCelula : uint8_t { Numero, Texto, Erro, Vazia };
+
+// Coluna de planilha com tipos misturados. As etiquetas de tipo (1 byte
+// por célula) ficam separadas das cargas (8 bytes por célula): o double
+// do número ou o índice do texto/erro na sua ColunaTexto. Uma passada
+// pelas etiquetas basta para separar os tipos sem tocar nas cargas.
+class ColunaCelulas {
+public:
+    string nome;
+
+    // NaN vira o erro #NUM!: nenhum núcleo numérico recebe NaN
+    void adicionarNumero(double valor);
+    void adicionarTexto(string_view texto);
+    void adicionarErro(string_view codigo);
+    void adicionarVazia();
+
+    // Classifica um campo de CSV como o Calc faria ao importar: vazio,
+    // número finito, código de erro (#N/A, #DIV/0!, Err:502, ...) ou texto
+    void adicionarCampo(string_view campo);
+
+    size_t size() const { return tiposCelulas.size(); }
+    bool empty() const { return tiposCelulas.empty(); }
+    size_t contar(TipoCelula tipo) const;
+
+    TipoCelula tipo(size_t i) const { return tiposCelulas[i]; }
+    double numero(size_t i) const;
+    string_view texto(size_t i) const;      // texto ou código de erro
+
+    const vector<TipoCelula>& tipos() const { return tiposCelulas; }
+
+    // Textos e erros na ordem em que entraram; a carga de cada célula de
+    // texto/erro é a linha correspondente aqui
+    const ColunaTexto& textos() const { return textosCelulas; }
+    const ColunaTexto& erros() const { return errosCelulas; }
+
+    ColunaCelulas prefixo(size_t n) const;
+
+    // Reordena as células: posição i passa a ter a célula permutacao[i]
+    void aplicarPermutacao(const vector<size_t>& permutacao);
+
+    // Reescreve a coluna já em segmentos com os números, textos e erros
+    // nas ordens dadas (linhas de textos()/erros()): números, textos,
+    // erros na crescente; erros, textos, números na decrescente; as
+    // vazias sempre por último
+    void reconstruir(const vector<double>& numeros, const vector<size_t>& ordemTextos,
+                     const vector<size_t>& ordemErros, size_t vazias, bool crescente);
+
+private:
+    vector<TipoCelula> tiposCelulas;
+    vector<uint64_t> cargas;
+    ColunaTexto textosCelulas;
+    ColunaTexto errosCelulas;
+};
+
+#endif
@@ -0,0 +1,43 @@
+#include "coluna_texto.h"
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+using namespace std;
+
+void ColunaTexto::reservar(size_t numLinhas, size_t numBytes) {
+    linhas.reserve(numLinhas);
+    arena.reserve(numBytes);
+}
+
+void ColunaTexto::adicionar(const char* texto, size_t tamanho) {
+    size_t inicio = arena.size();
+    if (tamanho > UINT32_MAX - inicio) {
+        throw length_error("ColunaTexto " + nome + ": arena passaria de 4 GiB");
+    }
+    arena.resize(inicio + tamanho);
+    if (tamanho > 0) memcpy(arena.data() + inicio, texto, tamanho);
+    linhas.push_back({static_cast<uint32_t>(inicio), static_cast<uint32_t>(tamanho)});
+}
+
+ColunaTexto ColunaTexto::prefixo(size_t n) const {
+    ColunaTexto copia;
+    copia.nome = nome;
+    n = min(n, linhas.size());
+
+    // As linhas podem já ter sido permutadas: copia a arena até o fim da
+    // visão mais distante entre as n primeiras
+    size_t fim = 0;
+    for (size_t i = 0; i < n; i++) {
+        fim = max(fim, static_cast<size_t>(linhas[i].inicio) + linhas[i].tamanho);
+    }
+    copia.arena.assign(arena.begin(), arena.begin() + fim);
+    copia.linhas.assign(linhas.begin(), linhas.begin() + n);
+    return copia;
+}
+
+void ColunaTexto::aplicarPermutacao(const vector<size_t>& permutacao) {
+    vector<VisaoTexto> reordenadas(permutacao.size());
+    for (size_t i = 0; i < permutacao.size(); i++) reordenadas[i] = linhas[permutacao[i]];
+    linhas.swap(reordenadas);
+}
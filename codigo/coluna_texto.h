@@ -0,0 +1,55 @@
+#ifndef COLUNA_TEXTO_H
+#define COLUNA_TEXTO_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace std;
+
+// Trecho [inicio, inicio + tamanho) da arena de uma ColunaTexto. Com 8
+// bytes por linha, ordenar as visões move bem menos memória que ordenar
+// vector<string>, e os textos nunca saem do lugar.
+struct VisaoTexto {
+    uint32_t inicio;
+    uint32_t tamanho;
+};
+
+// Coluna de texto (UTF-8) com todos os bytes numa única arena contígua e
+// uma visão por linha. As ordenações permutam só as visões; a arena é
+// limitada a 4 GiB pelos deslocamentos de 32 bits (adicionar lança
+// length_error além disso).
+class ColunaTexto {
+public:
+    string nome;
+
+    void reservar(size_t linhas, size_t bytes);
+    void adicionar(const char* texto, size_t tamanho);
+    void adicionar(string_view texto) { adicionar(texto.data(), texto.size()); }
+
+    size_t size() const { return linhas.size(); }
+    bool empty() const { return linhas.empty(); }
+    size_t bytes() const { return arena.size(); }
+
+    string_view operator[](size_t i) const {
+        return string_view(arena.data() + linhas[i].inicio, linhas[i].tamanho);
+    }
+
+    const char* base() const { return arena.data(); }
+    vector<VisaoTexto>& visoes() { return linhas; }
+    const vector<VisaoTexto>& visoes() const { return linhas; }
+
+    // Cópia das n primeiras linhas (só a parte da arena que elas usam)
+    ColunaTexto prefixo(size_t n) const;
+
+    // Reordena as linhas: posição i passa a ter a linha permutacao[i]
+    void aplicarPermutacao(const vector<size_t>& permutacao);
+
+private:
+    vector<char> arena;
+    vector<VisaoTexto> linhas;
+};
+
+#endif
@@ -0,0 +1,228 @@
+#include "contador_alocacoes.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#ifdef __linux__
+#include <malloc.h>
+#include <sys/resource.h>
+#endif
+
+using namespace std;
+
+namespace {
+
+// Contagens de uma thread desde o último iniciar(). Só a própria thread
+// escreve (load + store, sem leitura-modificação-escrita); parar() lê
+// todas. vivos pode ficar negativo quando a thread libera blocos de
+// outra ou de antes da região.
+struct alignas(64) ContagemThread {
+    atomic<uint64_t> alocacoes{0};
+    atomic<uint64_t> bytes{0};
+    atomic<int64_t> vivos{0};
+    atomic<int64_t> pico{0};
+};
+
+// Threads além de MAX_THREADS dividem a última posição, que então é
+// atualizada com fetch_add (o pico dela é aproximado)
+const int MAX_THREADS = 256;
+const int POSICAO_COMPARTILHADA = MAX_THREADS - 1;
+
+// Inicialização constante: valem desde a primeira alocação, antes de
+// qualquer construtor estático
+ContagemThread contagens[MAX_THREADS];
+atomic<int> threadsRegistradas{0};
+atomic<bool> ativo{false};
+
+thread_local int posicaoThread = -1;
+
+size_t tamanhoBloco(void* ponteiro) {
+#ifdef __linux__
+    return malloc_usable_size(ponteiro);
+#else
+    (void)ponteiro;
+    return 0;
+#endif
+}
+
+int minhaPosicao() {
+    if (posicaoThread < 0) {
+        int posicao = threadsRegistradas.fetch_add(1, memory_order_relaxed);
+        posicaoThread = min(posicao, POSICAO_COMPARTILHADA);
+    }
+    return posicaoThread;
+}
+
+void somarContagem(atomic<uint64_t>& contador, uint64_t valor, bool compartilhada) {
+    if (compartilhada) contador.fetch_add(valor, memory_order_relaxed);
+    else contador.store(contador.load(memory_order_relaxed) + valor, memory_order_relaxed);
+}
+
+// Fora de uma região medida o custo é uma leitura relaxada
+void registrar(void* ponteiro, bool alocacao) {
+    if (!ativo.load(memory_order_relaxed)) return;
+    int posicao = minhaPosicao();
+    bool compartilhada = posicao == POSICAO_COMPARTILHADA;
+    ContagemThread& contagem = contagens[posicao];
+    int64_t tamanho = static_cast<int64_t>(tamanhoBloco(ponteiro));
+
+    if (!alocacao) {
+        if (compartilhada) contagem.vivos.fetch_sub(tamanho, memory_order_relaxed);
+        else contagem.vivos.store(contagem.vivos.load(memory_order_relaxed) - tamanho,
+                                  memory_order_relaxed);
+        return;
+    }
+    somarContagem(contagem.alocacoes, 1, compartilhada);
+    somarContagem(contagem.bytes, static_cast<uint64_t>(tamanho), compartilhada);
+    int64_t atual = compartilhada
+                        ? contagem.vivos.fetch_add(tamanho, memory_order_relaxed) + tamanho
+                        : contagem.vivos.load(memory_order_relaxed) + tamanho;
+    if (!compartilhada) contagem.vivos.store(atual, memory_order_relaxed);
+    if (atual > contagem.pico.load(memory_order_relaxed)) {
+        contagem.pico.store(atual, memory_order_relaxed);
+    }
+}
+
+void* alocar(size_t tamanho) {
+    void* ponteiro = malloc(tamanho ? tamanho : 1);
+    if (ponteiro) registrar(ponteiro, true);
+    return ponteiro;
+}
+
+void* alocarAlinhado(size_t tamanho, align_val_t alinhamento) {
+    void* ponteiro = nullptr;
+    size_t bytes = max(static_cast<size_t>(alinhamento), sizeof(void*));
+    if (posix_memalign(&ponteiro, bytes, tamanho ? tamanho : 1) != 0) return nullptr;
+    registrar(ponteiro, true);
+    return ponteiro;
+}
+
+// Laço exigido pelo padrão: chama o new_handler instalado e tenta de
+// novo; sem handler, bad_alloc
+template <typename Alocador>
+void* alocarOuLancar(Alocador alocador) {
+    for (;;) {
+        void* ponteiro = alocador();
+        if (ponteiro) return ponteiro;
+        new_handler handler = get_new_handler();
+        if (!handler) throw bad_alloc();
+        handler();
+    }
+}
+
+void liberar(void* ponteiro) {
+    if (!ponteiro) return;
+    registrar(ponteiro, false);
+    free(ponteiro);
+}
+
+}
+
+void LeituraAlocacoes::somar(const LeituraAlocacoes& outra) {
+    alocacoes += outra.alocacoes;
+    bytesAlocados += outra.bytesAlocados;
+    picoBytes = max(picoBytes, outra.picoBytes);
+    rssMaximoKb = max(rssMaximoKb, outra.rssMaximoKb);
+}
+
+void LeituraAlocacoes::dividir(double n) {
+    if (n <= 0) return;
+    alocacoes /= n;
+    bytesAlocados /= n;
+}
+
+void ContadorAlocacoes::iniciar() {
+    int registradas = min(threadsRegistradas.load(memory_order_relaxed), MAX_THREADS);
+    for (int i = 0; i < registradas; i++) {
+        contagens[i].alocacoes.store(0, memory_order_relaxed);
+        contagens[i].bytes.store(0, memory_order_relaxed);
+        contagens[i].vivos.store(0, memory_order_relaxed);
+        contagens[i].pico.store(0, memory_order_relaxed);
+    }
+    ativo.store(true, memory_order_seq_cst);
+}
+
+LeituraAlocacoes ContadorAlocacoes::parar() {
+    ativo.store(false, memory_order_seq_cst);
+
+    LeituraAlocacoes leitura;
+    int64_t picos = 0;
+    int registradas = min(threadsRegistradas.load(memory_order_relaxed), MAX_THREADS);
+    for (int i = 0; i < registradas; i++) {
+        leitura.alocacoes += contagens[i].alocacoes.load(memory_order_relaxed);
+        leitura.bytesAlocados += contagens[i].bytes.load(memory_order_relaxed);
+        picos += contagens[i].pico.load(memory_order_relaxed);
+    }
+    leitura.picoBytes = static_cast<double>(picos);
+
+#ifdef __linux__
+    rusage uso;
+    if (getrusage(RUSAGE_SELF, &uso) == 0) leitura.rssMaximoKb = uso.ru_maxrss;
+#endif
+    return leitura;
+}
+
+// Substituições globais (todas as formas, para que nenhum bloco alocado
+// por aqui seja liberado pelo operador padrão ou vice-versa)
+
+void* operator new(size_t tamanho) {
+    return alocarOuLancar([tamanho] { return alocar(tamanho); });
+}
+
+void* operator new[](size_t tamanho) {
+    return alocarOuLancar([tamanho] { return alocar(tamanho); });
+}
+
+void* operator new(size_t tamanho, const nothrow_t&) noexcept {
+    try {
+        return alocarOuLancar([tamanho] { return alocar(tamanho); });
+    } catch (const bad_alloc&) {
+        return nullptr;
+    }
+}
+
+void* operator new[](size_t tamanho, const nothrow_t&) noexcept {
+    try {
+        return alocarOuLancar([tamanho] { return alocar(tamanho); });
+    } catch (const bad_alloc&) {
+        return nullptr;
+    }
+}
+
+void* operator new(size_t tamanho, align_val_t alinhamento) {
+    return alocarOuLancar([tamanho, alinhamento] { return alocarAlinhado(tamanho, alinhamento); });
+}
+
+void* operator new[](size_t tamanho, align_val_t alinhamento) {
+    return alocarOuLancar([tamanho, alinhamento] { return alocarAlinhado(tamanho, alinhamento); });
+}
+
+void* operator new(size_t tamanho, align_val_t alinhamento, const nothrow_t&) noexcept {
+    try {
+        return alocarOuLancar([tamanho, alinhamento] { return alocarAlinhado(tamanho, alinhamento); });
+    } catch (const bad_alloc&) {
+        return nullptr;
+    }
+}
+
+void* operator new[](size_t tamanho, align_val_t alinhamento, const nothrow_t&) noexcept {
+    try {
+        return alocarOuLancar([tamanho, alinhamento] { return alocarAlinhado(tamanho, alinhamento); });
+    } catch (const bad_alloc&) {
+        return nullptr;
+    }
+}
+
+void operator delete(void* ponteiro) noexcept { liberar(ponteiro); }
+void operator delete[](void* ponteiro) noexcept { liberar(ponteiro); }
+void operator delete(void* ponteiro, size_t) noexcept { liberar(ponteiro); }
+void operator delete[](void* ponteiro, size_t) noexcept { liberar(ponteiro); }
+void operator delete(void* ponteiro, const nothrow_t&) noexcept { liberar(ponteiro); }
+void operator delete[](void* ponteiro, const nothrow_t&) noexcept { liberar(ponteiro); }
+void operator delete(void* ponteiro, align_val_t) noexcept { liberar(ponteiro); }
+void operator delete[](void* ponteiro, align_val_t) noexcept { liberar(ponteiro); }
+void operator delete(void* ponteiro, size_t, align_val_t) noexcept { liberar(ponteiro); }
+void operator delete[](void* ponteiro, size_t, align_val_t) noexcept { liberar(ponteiro); }
+void operator delete(void* ponteiro, align_val_t, const nothrow_t&) noexcept { liberar(ponteiro); }
+void operator delete[](void* ponteiro, align_val_t, const nothrow_t&) noexcept { liberar(ponteiro); }
@@ -0,0 +1,35 @@
+#ifndef CONTADOR_ALOCACOES_H
+#define CONTADOR_ALOCACOES_H
+
+#include <cstdint>
+
+using namespace std;
+
+// Memória usada numa região medida. Os bytes são os tamanhos reais dos
+// blocos do malloc (malloc_usable_size), não os pedidos.
+struct LeituraAlocacoes {
+    double alocacoes = 0;        // chamadas a operator new
+    double bytesAlocados = 0;
+    double picoBytes = 0;        // soma dos picos de bytes vivos de cada thread
+    long rssMaximoKb = 0;        // getrusage: pico de RSS do processo até o fim
+
+    // Acumula outra leitura (contagens somadas, picos pelo máximo) e
+    // divide as contagens por n no final
+    void somar(const LeituraAlocacoes& outra);
+    void dividir(double n);
+};
+
+// Contabilidade de alocações pelos operator new/delete globais substituídos
+// em contador_alocacoes.cpp. Só conta entre iniciar() e parar(): fora
+// disso cada new/delete paga uma leitura relaxada de uma flag. Cada
+// thread (inclusive as do pool do Parallel Sort) conta na sua posição e
+// parar() soma as posições. O pico é a soma dos picos por thread: exato
+// com uma thread, limite superior quando várias alocam ao mesmo tempo.
+// Regiões não podem ser aninhadas.
+class ContadorAlocacoes {
+public:
+    static void iniciar();
+    static LeituraAlocacoes parar();
+};
+
+#endif
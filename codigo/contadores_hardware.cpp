@@ -0,0 +1,173 @@
+#include "contadores_hardware.h"
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include <cstring>
+
+using namespace std;
+
+bool LeituraContadores::algumDisponivel() const {
+    for (int e = 0; e < NUM_EVENTOS; e++) {
+        if (disponivel[e]) return true;
+    }
+    return false;
+}
+
+double LeituraContadores::ipc() const {
+    if (!disponivel[EVENTO_CICLOS] || !disponivel[EVENTO_INSTRUCOES] ||
+        valores[EVENTO_CICLOS] == 0) return 0;
+    return valores[EVENTO_INSTRUCOES] / valores[EVENTO_CICLOS];
+}
+
+void LeituraContadores::somar(const LeituraContadores& outra) {
+    for (int e = 0; e < NUM_EVENTOS; e++) {
+        valores[e] += outra.valores[e];
+        disponivel[e] = (somadas == 0 || disponivel[e]) && outra.disponivel[e];
+    }
+    somadas++;
+}
+
+void LeituraContadores::dividir(double n) {
+    if (n <= 0) return;
+    for (int e = 0; e < NUM_EVENTOS; e++) valores[e] /= n;
+}
+
+const char* ContadoresHardware::nomeEvento(int evento) {
+    static const char* nomes[NUM_EVENTOS] = {
+        "Ciclos", "Instrucoes", "Miss_L1d", "Miss_LLC", "Miss_Desvio", "Miss_dTLB"};
+    return nomes[evento];
+}
+
+#ifdef __linux__
+
+namespace {
+
+uint64_t configuracaoCache(uint64_t cache) {
+    return cache | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+}
+
+// lider < 0 abre o líder do grupo (desligado); os demais entram no grupo
+// ligados e passam a seguir o líder
+int abrirEvento(int evento, int lider) {
+    perf_event_attr atributos;
+    memset(&atributos, 0, sizeof(atributos));
+    atributos.size = sizeof(atributos);
+    atributos.disabled = lider < 0;
+    atributos.exclude_kernel = 1;
+    atributos.exclude_hv = 1;
+    // Uma leitura do líder traz todos os valores com os tempos do grupo.
+    // Com multiplexação o grupo inteiro entra e sai junto, e os valores
+    // são escalados pela fração do tempo em que ele esteve ativo.
+    atributos.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_ID | PERF_FORMAT_TOTAL_TIME_ENABLED |
+                            PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+    switch (evento) {
+        case EVENTO_CICLOS:
+            atributos.type = PERF_TYPE_HARDWARE;
+            atributos.config = PERF_COUNT_HW_CPU_CYCLES;
+            break;
+        case EVENTO_INSTRUCOES:
+            atributos.type = PERF_TYPE_HARDWARE;
+            atributos.config = PERF_COUNT_HW_INSTRUCTIONS;
+            break;
+        case EVENTO_MISSES_L1D:
+            atributos.type = PERF_TYPE_HW_CACHE;
+            atributos.config = configuracaoCache(PERF_COUNT_HW_CACHE_L1D);
+            break;
+        case EVENTO_MISSES_LLC:
+            atributos.type = PERF_TYPE_HW_CACHE;
+            atributos.config = configuracaoCache(PERF_COUNT_HW_CACHE_LL);
+            break;
+        case EVENTO_MISSES_DESVIO:
+            atributos.type = PERF_TYPE_HARDWARE;
+            atributos.config = PERF_COUNT_HW_BRANCH_MISSES;
+            break;
+        case EVENTO_MISSES_DTLB:
+            atributos.type = PERF_TYPE_HW_CACHE;
+            atributos.config = configuracaoCache(PERF_COUNT_HW_CACHE_DTLB);
+            break;
+    }
+
+    return static_cast<int>(syscall(SYS_perf_event_open, &atributos, 0, -1, lider, 0));
+}
+
+}
+
+ContadoresHardware::ContadoresHardware() {
+    // Evento que o kernel recusa fica de fora; o primeiro aceito lidera
+    for (int e = 0; e < NUM_EVENTOS; e++) {
+        descritores[e] = abrirEvento(e, lider);
+        if (descritores[e] < 0) continue;
+        if (ioctl(descritores[e], PERF_EVENT_IOC_ID, &ids[e]) != 0) {
+            close(descritores[e]);
+            descritores[e] = -1;
+            continue;
+        }
+        if (lider < 0) lider = descritores[e];
+    }
+}
+
+ContadoresHardware::~ContadoresHardware() {
+    // Membros antes do líder
+    for (int e = NUM_EVENTOS - 1; e >= 0; e--) {
+        if (descritores[e] >= 0) close(descritores[e]);
+    }
+}
+
+void ContadoresHardware::iniciar() {
+    if (lider < 0) return;
+    ioctl(lider, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(lider, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+}
+
+LeituraContadores ContadoresHardware::parar() {
+    LeituraContadores leitura;
+    if (lider < 0) return leitura;
+    ioctl(lider, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+
+    // nr, tempo habilitado, tempo em execução e (valor, id) por membro
+    uint64_t dados[3 + 2 * NUM_EVENTOS];
+    ssize_t lidos = read(lider, dados, sizeof(dados));
+    if (lidos < static_cast<ssize_t>(3 * sizeof(uint64_t)) || dados[2] == 0) return leitura;
+    uint64_t membros = dados[0];
+    if (membros > NUM_EVENTOS ||
+        static_cast<size_t>(lidos) < (3 + 2 * membros) * sizeof(uint64_t)) return leitura;
+
+    double escala = static_cast<double>(dados[1]) / dados[2];
+    for (uint64_t m = 0; m < membros; m++) {
+        uint64_t valor = dados[3 + 2 * m];
+        uint64_t id = dados[4 + 2 * m];
+        for (int e = 0; e < NUM_EVENTOS; e++) {
+            if (descritores[e] < 0 || ids[e] != id) continue;
+            leitura.valores[e] = valor * escala;
+            leitura.disponivel[e] = true;
+        }
+    }
+    return leitura;
+}
+
+#else
+
+ContadoresHardware::ContadoresHardware() {
+    for (int e = 0; e < NUM_EVENTOS; e++) descritores[e] = -1;
+}
+
+ContadoresHardware::~ContadoresHardware() {}
+
+void ContadoresHardware::iniciar() {}
+
+LeituraContadores ContadoresHardware::parar() { return LeituraContadores(); }
+
+#endif
+
+bool ContadoresHardware::disponivel() const {
+    for (int e = 0; e < NUM_EVENTOS; e++) {
+        if (descritores[e] >= 0) return true;
+    }
+    return false;
+}
@@ -0,0 +1,63 @@
+#ifndef CONTADORES_HARDWARE_H
+#define CONTADORES_HARDWARE_H
+
+#include <cstdint>
+
+using namespace std;
+
+enum EventoHardware {
+    EVENTO_CICLOS,
+    EVENTO_INSTRUCOES,
+    EVENTO_MISSES_L1D,
+    EVENTO_MISSES_LLC,
+    EVENTO_MISSES_DESVIO,
+    EVENTO_MISSES_DTLB,
+    NUM_EVENTOS
+};
+
+// Valores por execução; um evento que o kernel/CPU não oferece fica com
+// disponivel[e] = false e valor 0
+struct LeituraContadores {
+    double valores[NUM_EVENTOS] = {};
+    bool disponivel[NUM_EVENTOS] = {};
+    int somadas = 0;            // leituras acumuladas por somar()
+
+    bool algumDisponivel() const;
+    double ipc() const;
+
+    // Acumula outra leitura (mesmos eventos) e divide por n no final; um
+    // evento só fica disponível se esteve em todas as leituras somadas
+    void somar(const LeituraContadores& outra);
+    void dividir(double n);
+};
+
+// Contadores de hardware via perf_event_open, só no espaço de usuário e
+// só na thread que chamou iniciar(): nos algoritmos paralelos o trabalho
+// das threads do pool não entra na contagem. Os eventos formam um grupo
+// (o primeiro aberto é o líder): ligados, desligados e multiplexados
+// juntos, contam sobre a mesma janela, e razões como IPC e taxas de miss
+// são consistentes. Sem suporte (outro sistema operacional, container,
+// perf_event_paranoid alto) os contadores ficam indisponíveis e
+// iniciar/parar não fazem nada.
+class ContadoresHardware {
+public:
+    ContadoresHardware();
+    ~ContadoresHardware();
+
+    ContadoresHardware(const ContadoresHardware&) = delete;
+    ContadoresHardware& operator=(const ContadoresHardware&) = delete;
+
+    bool disponivel() const;
+
+    void iniciar();
+    LeituraContadores parar();
+
+    static const char* nomeEvento(int evento);
+
+private:
+    int descritores[NUM_EVENTOS];
+    uint64_t ids[NUM_EVENTOS] = {};  // PERF_EVENT_IOC_ID de cada descritor
+    int lider = -1;
+};
+
+#endif
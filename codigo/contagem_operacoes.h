@@ -0,0 +1,67 @@
+#ifndef CONTAGEM_OPERACOES_H
+#define CONTAGEM_OPERACOES_H
+
+#include <cstddef>
+#include <cstdint>
+
+using namespace std;
+
+// Política de contagem de operações dos núcleos de ordenacao_generica.h:
+// comparações (pelo comparador envolvido), movimentos de elementos
+// (atribuições), trocas, profundidade máxima de recursão e quantas vezes
+// o introsort caiu para o heap sort ou terminou uma folha por inserção.
+struct ContagemOperacoes {
+    uint64_t comparacoes = 0;
+    uint64_t movimentos = 0;
+    uint64_t trocas = 0;
+    uint64_t profundidadeMaxima = 0;
+    uint64_t fallbacksHeapSort = 0;
+    uint64_t folhasInsercao = 0;
+
+    void moverElementos(ptrdiff_t n) { movimentos += n; }
+    void trocarElementos(ptrdiff_t n) { trocas += n; }
+    void entrarRecursao() {
+        if (++profundidadeAtual > profundidadeMaxima) profundidadeMaxima = profundidadeAtual;
+    }
+    void sairRecursao() { --profundidadeAtual; }
+    void registrarFallbackHeapSort() { fallbacksHeapSort++; }
+    void registrarFolhaInsercao() { folhasInsercao++; }
+
+private:
+    uint64_t profundidadeAtual = 0;
+};
+
+namespace ordenacao {
+
+// Política padrão: ganchos vazios, eliminados pelo compilador
+struct SemContagem {
+    void moverElementos(ptrdiff_t) {}
+    void trocarElementos(ptrdiff_t) {}
+    void entrarRecursao() {}
+    void sairRecursao() {}
+    void registrarFallbackHeapSort() {}
+    void registrarFolhaInsercao() {}
+};
+
+// Comparador que conta as chamadas. Os núcleos não envolvem o comparador
+// sozinhos (chamam uns aos outros); quem conta envolve uma vez na entrada.
+template <class Compare>
+struct ComparadorContado {
+    Compare comp;
+    uint64_t* comparacoes;
+
+    template <class A, class B>
+    bool operator()(const A& a, const B& b) {
+        ++*comparacoes;
+        return comp(a, b);
+    }
+};
+
+template <class Compare>
+ComparadorContado<Compare> contarComparacoes(Compare comp, ContagemOperacoes& contagem) {
+    return ComparadorContado<Compare>{comp, &contagem.comparacoes};
+}
+
+}
+
+#endif
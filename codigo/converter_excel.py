@@ -92,11 +92,53 @@ def converter_excel_para_csv(arquivo_excel, arquivo_csv=None, coluna_dados=None)
         print(f"Erro ao processar arquivo: {e}")
         return None
 
+def converter_colunas_para_csv(arquivo_excel, colunas, arquivo_csv=None):
+    """
+    Exporta várias colunas numéricas para CSV (ordenação multichave)
+    
+    Args:
+        arquivo_excel: Caminho para arquivo .xlsx
+        colunas: Lista de índices de colunas, na ordem desejada
+        arquivo_csv: Caminho de saída (opcional)
+    """
+    try:
+        print(f"Lendo arquivo: {arquivo_excel}")
+        df = pd.read_excel(arquivo_excel)
+        
+        for indice in colunas:
+            if indice >= len(df.columns):
+                print(f"Erro: Índice {indice} inválido! Máximo: {len(df.columns)-1}")
+                return None
+        
+        nomes = [df.columns[i] for i in colunas]
+        print(f"Colunas selecionadas: {nomes}")
+        
+        # Mantém apenas linhas em que todas as colunas são numéricas
+        dados = df[nomes].apply(pd.to_numeric, errors='coerce').dropna()
+        print(f"Linhas válidas encontradas: {len(dados)}")
+        
+        if len(dados) == 0:
+            print("Erro: Nenhuma linha numérica válida encontrada!")
+            return None
+        
+        if arquivo_csv is None:
+            base_name = os.path.splitext(os.path.basename(arquivo_excel))[0]
+            arquivo_csv = f"../dados/dados_multichave_{base_name}.csv"
+        
+        dados.to_csv(arquivo_csv, index=False)
+        print(f"Arquivo CSV criado: {arquivo_csv}")
+        return arquivo_csv
+        
+    except Exception as e:
+        print(f"Erro ao processar arquivo: {e}")
+        return None
+
 def main():
     if len(sys.argv) < 2:
         print("Uso: python3 converter_excel.py <arquivo.xlsx> [--coluna NOME_OU_INDICE]")
         print("Exemplo: python3 converter_excel.py planilha.xlsx --coluna Vendas")
         print("Exemplo: python3 converter_excel.py planilha.xlsx --coluna 1")
+        print("Exemplo: python3 converter_excel.py planilha.xlsx --colunas 11,1")
         return
     
     arquivo_excel = sys.argv[1]
@@ -115,6 +157,12 @@ def main():
         print(f"Erro: Arquivo '{arquivo_excel}' não encontrado!")
         return
     
+    # Várias colunas para a ordenação multichave
+    if len(sys.argv) > 3 and sys.argv[2] == '--colunas':
+        colunas = [int(c) for c in sys.argv[3].split(',')]
+        converter_colunas_para_csv(arquivo_excel, colunas)
+        return
+    
     converter_excel_para_csv(arquivo_excel, coluna_dados=coluna_dados)
 
 if __name__ == "__main__":
@@ -1,8 +1,16 @@
 #include "csv_reader.h"
+#include "pool_tarefas.h"
 #include <iostream>
 #include <sstream>
 #include <random>
 #include <iomanip>
+#include <charconv>
+#include <chrono>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 using namespace std;
 
@@ -43,6 +51,384 @@ vector<double> CSVReader::lerArquivoCSV(const string& nomeArquivo, int coluna) {
     return dados;
 }
 
+vector<double> CSVReader::lerArquivoCSVMapeado(const string& nomeArquivo, int coluna,
+                                               unsigned numThreads,
+                                               EstatisticasLeitura* estatisticas) {
+    auto inicioLeitura = chrono::high_resolution_clock::now();
+    vector<double> dados;
+    
+    int fd = open(nomeArquivo.c_str(), O_RDONLY);
+    if (fd < 0) {
+        cerr << "Erro ao abrir arquivo: " << nomeArquivo << endl;
+        return dados;
+    }
+    
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size == 0) {
+        close(fd);
+        return dados;
+    }
+    
+    size_t tamanho = info.st_size;
+    void* mapa = mmap(nullptr, tamanho, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapa == MAP_FAILED) {
+        cerr << "Erro ao mapear arquivo: " << nomeArquivo << endl;
+        return dados;
+    }
+    madvise(mapa, tamanho, MADV_SEQUENTIAL);
+    
+    const char* texto = static_cast<const char*>(mapa);
+    const char* fimTexto = texto + tamanho;
+    
+    // Pula cabeçalho se existir (mesma regra de lerArquivoCSV)
+    const char* inicioDados = texto;
+    const char* fimPrimeira = static_cast<const char*>(memchr(texto, '\n', tamanho));
+    if (!fimPrimeira) fimPrimeira = fimTexto;
+    for (const char* p = texto; p < fimPrimeira; p++) {
+        if (!strchr("0123456789.,-\r", *p)) {
+            inicioDados = fimPrimeira < fimTexto ? fimPrimeira + 1 : fimTexto;
+            break;
+        }
+    }
+    
+    // Blocos com fronteiras ajustadas para o início da próxima linha
+    PoolTarefas& pool = PoolTarefas::compartilhado(numThreads);
+    size_t numBlocos = pool.numThreads();
+    size_t bytesDados = fimTexto - inicioDados;
+    if (bytesDados < (1 << 20)) numBlocos = 1;
+    
+    vector<const char*> fronteiras(numBlocos + 1, fimTexto);
+    fronteiras[0] = inicioDados;
+    for (size_t b = 1; b < numBlocos; b++) {
+        const char* p = max(inicioDados + bytesDados * b / numBlocos, fronteiras[b - 1]);
+        const char* quebra = static_cast<const char*>(memchr(p, '\n', fimTexto - p));
+        fronteiras[b] = quebra ? quebra + 1 : fimTexto;
+    }
+    
+    // 1ª passada: conta linhas por bloco para pré-alocar a coluna
+    vector<size_t> linhasBloco(numBlocos, 0);
+    vector<size_t> validasBloco(numBlocos, 0);
+    atomic<size_t> pendentes(numBlocos);
+    for (size_t b = 0; b < numBlocos; b++) {
+        pool.submeter([&, b]() {
+            size_t linhas = 0;
+            const char* p = fronteiras[b];
+            while (p < fronteiras[b + 1]) {
+                const char* quebra = static_cast<const char*>(memchr(p, '\n', fronteiras[b + 1] - p));
+                linhas++;
+                p = quebra ? quebra + 1 : fronteiras[b + 1];
+            }
+            linhasBloco[b] = linhas;
+            pendentes--;
+        });
+    }
+    pool.aguardar(pendentes);
+    
+    vector<size_t> deslocamento(numBlocos + 1, 0);
+    for (size_t b = 0; b < numBlocos; b++) {
+        deslocamento[b + 1] = deslocamento[b] + linhasBloco[b];
+    }
+    dados.resize(deslocamento[numBlocos]);
+    
+    // 2ª passada: converte o campo selecionado direto para a fatia do bloco
+    pendentes = numBlocos;
+    for (size_t b = 0; b < numBlocos; b++) {
+        pool.submeter([&, b]() {
+            double* saida = dados.data() + deslocamento[b];
+            size_t validas = 0;
+            const char* p = fronteiras[b];
+            
+            while (p < fronteiras[b + 1]) {
+                const char* quebra = static_cast<const char*>(memchr(p, '\n', fronteiras[b + 1] - p));
+                const char* fimLinha = quebra ? quebra : fronteiras[b + 1];
+                
+                const char* campoInicio;
+                const char* campoFim;
+                double valor;
+                if (extrairCampo(p, fimLinha, coluna, campoInicio, campoFim) &&
+                    converterCampo(campoInicio, campoFim, valor)) {
+                    saida[validas++] = valor;
+                }
+                p = quebra ? quebra + 1 : fronteiras[b + 1];
+            }
+            validasBloco[b] = validas;
+            pendentes--;
+        });
+    }
+    pool.aguardar(pendentes);
+    munmap(mapa, tamanho);
+    
+    // Compacta as fatias (linhas inválidas deixam lacunas no fim de cada bloco)
+    size_t total = 0;
+    for (size_t b = 0; b < numBlocos; b++) {
+        if (total != deslocamento[b]) {
+            memmove(dados.data() + total, dados.data() + deslocamento[b],
+                    validasBloco[b] * sizeof(double));
+        }
+        total += validasBloco[b];
+    }
+    dados.resize(total);
+    
+    auto fimLeitura = chrono::high_resolution_clock::now();
+    EstatisticasLeitura est;
+    est.linhas = total;
+    est.descartadas = deslocamento[numBlocos] - total;
+    est.bytes = tamanho;
+    est.threads = numBlocos;
+    est.tempoMs = chrono::duration_cast<chrono::microseconds>(fimLeitura - inicioLeitura).count() / 1000.0;
+    if (estatisticas) *estatisticas = est;
+    
+    // Formatação num fluxo local: o estado de cout fica como estava
+    ostringstream taxas;
+    taxas << fixed << setprecision(0) << est.linhasPorSegundo() << " linhas/s, "
+          << setprecision(1) << est.mbPorSegundo() << " MB/s";
+    cout << "Lidos " << dados.size() << " valores do arquivo " << nomeArquivo
+         << " (mmap, " << est.threads << " threads, " << taxas.str() << ")" << endl;
+    return dados;
+}
+
+bool CSVReader::extrairCampo(const char* inicio, const char* fim, int coluna,
+                             const char*& campoInicio, const char*& campoFim) {
+    const char* p = inicio;
+    
+    for (int atual = 0; ; atual++) {
+        // Campo entre aspas: vírgulas internas não separam campos
+        const char* fimCampo;
+        if (p < fim && *p == '"') {
+            const char* q = p + 1;
+            while (q < fim && !(*q == '"' && (q + 1 >= fim || q[1] != '"'))) {
+                q += (*q == '"') ? 2 : 1;
+            }
+            if (atual == coluna) {
+                campoInicio = p + 1;
+                campoFim = q;
+                return true;
+            }
+            fimCampo = static_cast<const char*>(memchr(q, ',', fim - q));
+        } else {
+            fimCampo = static_cast<const char*>(memchr(p, ',', fim - p));
+            if (atual == coluna) {
+                campoInicio = p;
+                campoFim = fimCampo ? fimCampo : fim;
+                return true;
+            }
+        }
+        
+        if (!fimCampo) return false;
+        p = fimCampo + 1;
+    }
+}
+
+bool CSVReader::converterCampo(const char* inicio, const char* fim, double& valor) {
+    while (inicio < fim && (*inicio == ' ' || *inicio == '\t')) inicio++;
+    while (fim > inicio && (fim[-1] == ' ' || fim[-1] == '\t' || fim[-1] == '\r')) fim--;
+    if (inicio < fim && *inicio == '+') inicio++;
+    if (inicio == fim) return false;
+    
+    auto resultado = from_chars(inicio, fim, valor);
+    return resultado.ec == errc() && resultado.ptr == fim;
+}
+
+TabelaColunas CSVReader::lerTabelaCSV(const string& nomeArquivo, const vector<int>& colunas) {
+    TabelaColunas tabela;
+    tabela.colunas.resize(colunas.size());
+    ifstream arquivo(nomeArquivo);
+    
+    if (!arquivo.is_open()) {
+        cerr << "Erro ao abrir arquivo: " << nomeArquivo << endl;
+        return tabela;
+    }
+    
+    string linha;
+    bool primeiraLinha = true;
+    size_t descartadas = 0;
+    vector<double> valores(colunas.size());
+    
+    while (getline(arquivo, linha)) {
+        vector<string> campos = split(linha, ',');
+        
+        // Cabeçalho: guarda os nomes das colunas selecionadas
+        if (primeiraLinha && linha.find_first_not_of("0123456789.,-") != string::npos) {
+            primeiraLinha = false;
+            for (int coluna : colunas) {
+                tabela.nomes.push_back(coluna < static_cast<int>(campos.size()) ? campos[coluna]
+                                                                                : to_string(coluna));
+            }
+            continue;
+        }
+        primeiraLinha = false;
+        
+        bool valida = true;
+        for (size_t k = 0; k < colunas.size() && valida; k++) {
+            if (colunas[k] >= static_cast<int>(campos.size())) {
+                valida = false;
+                break;
+            }
+            try {
+                valores[k] = stringParaDouble(campos[colunas[k]]);
+            } catch (const exception& e) {
+                valida = false;
+            }
+        }
+        
+        if (!valida) {
+            descartadas++;
+            continue;
+        }
+        for (size_t k = 0; k < colunas.size(); k++) {
+            tabela.colunas[k].push_back(valores[k]);
+        }
+    }
+    
+    arquivo.close();
+    cout << "Lidas " << tabela.numLinhas() << " linhas (" << colunas.size() << " colunas) do arquivo "
+         << nomeArquivo;
+    if (descartadas > 0) cout << " - " << descartadas << " linhas descartadas";
+    cout << endl;
+    return tabela;
+}
+
+bool CSVReader::percorrerCampos(const string& nomeArquivo, int coluna,
+                                const function<void(bool, bool, const string&)>& visitar,
+                                size_t& tamanhoArquivo) {
+    tamanhoArquivo = 0;
+    int fd = open(nomeArquivo.c_str(), O_RDONLY);
+    if (fd < 0) {
+        cerr << "Erro ao abrir arquivo: " << nomeArquivo << endl;
+        return false;
+    }
+    
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size == 0) {
+        close(fd);
+        return false;
+    }
+    
+    size_t tamanho = info.st_size;
+    void* mapa = mmap(nullptr, tamanho, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapa == MAP_FAILED) {
+        cerr << "Erro ao mapear arquivo: " << nomeArquivo << endl;
+        return false;
+    }
+    madvise(mapa, tamanho, MADV_SEQUENTIAL);
+    tamanhoArquivo = tamanho;
+    
+    const char* p = static_cast<const char*>(mapa);
+    const char* fimTexto = p + tamanho;
+    string campo;
+    bool primeira = true;
+    
+    while (p < fimTexto) {
+        const char* quebra = static_cast<const char*>(memchr(p, '\n', fimTexto - p));
+        const char* fimLinha = quebra ? quebra : fimTexto;
+        if (fimLinha > p && fimLinha[-1] == '\r') fimLinha--;
+        
+        const char* campoInicio;
+        const char* campoFim;
+        bool encontrado = extrairCampo(p, fimLinha, coluna, campoInicio, campoFim);
+        campo.clear();
+        if (encontrado) {
+            // Campo entre aspas: extrairCampo devolve o interior
+            campo.assign(campoInicio, campoFim);
+            if (campoInicio > p && campoInicio[-1] == '"') {
+                size_t escrita = 0;
+                for (size_t i = 0; i < campo.size(); i++, escrita++) {
+                    if (campo[i] == '"' && i + 1 < campo.size() && campo[i + 1] == '"') i++;
+                    campo[escrita] = campo[i];
+                }
+                campo.resize(escrita);
+            }
+        }
+        
+        visitar(primeira, encontrado, campo);
+        primeira = false;
+        p = quebra ? quebra + 1 : fimTexto;
+    }
+    munmap(mapa, tamanho);
+    return true;
+}
+
+ColunaTexto CSVReader::lerColunaTextoCSV(const string& nomeArquivo, int coluna, bool cabecalho,
+                                         EstatisticasLeitura* estatisticas) {
+    auto inicioLeitura = chrono::high_resolution_clock::now();
+    ColunaTexto textos;
+    size_t linhas = 0, descartadas = 0;
+    size_t tamanho = 0;
+    
+    bool lido = percorrerCampos(nomeArquivo, coluna,
+        [&](bool primeira, bool encontrado, const string& campo) {
+            if (primeira) {
+                // A arena nunca passa do tamanho do arquivo
+                textos.reservar(0, tamanho);
+                if (cabecalho) {
+                    if (encontrado) textos.nome = campo;
+                    return;
+                }
+            }
+            if (encontrado && !campo.empty()) {
+                textos.adicionar(campo);
+                linhas++;
+            } else {
+                descartadas++;
+            }
+        }, tamanho);
+    if (!lido) return textos;
+    if (textos.nome.empty()) textos.nome = to_string(coluna);
+    
+    auto fimLeitura = chrono::high_resolution_clock::now();
+    EstatisticasLeitura est;
+    est.linhas = linhas;
+    est.descartadas = descartadas;
+    est.bytes = tamanho;
+    est.threads = 1;
+    est.tempoMs = chrono::duration_cast<chrono::microseconds>(fimLeitura - inicioLeitura).count() / 1000.0;
+    if (estatisticas) *estatisticas = est;
+    
+    cout << "Lidos " << linhas << " textos (" << textos.bytes() << " bytes) do arquivo "
+         << nomeArquivo;
+    if (descartadas > 0) cout << " - " << descartadas << " linhas descartadas";
+    cout << endl;
+    return textos;
+}
+
+ColunaCelulas CSVReader::lerColunaCelulasCSV(const string& nomeArquivo, int coluna, bool cabecalho,
+                                             EstatisticasLeitura* estatisticas) {
+    auto inicioLeitura = chrono::high_resolution_clock::now();
+    ColunaCelulas celulas;
+    size_t tamanho = 0;
+    
+    bool lido = percorrerCampos(nomeArquivo, coluna,
+        [&](bool primeira, bool encontrado, const string& campo) {
+            if (primeira && cabecalho) {
+                if (encontrado) celulas.nome = campo;
+            } else if (encontrado) {
+                celulas.adicionarCampo(campo);
+            } else {
+                celulas.adicionarVazia();
+            }
+        }, tamanho);
+    if (!lido) return celulas;
+    if (celulas.nome.empty()) celulas.nome = to_string(coluna);
+    
+    auto fimLeitura = chrono::high_resolution_clock::now();
+    if (estatisticas) {
+        estatisticas->linhas = celulas.size();
+        estatisticas->descartadas = 0;
+        estatisticas->bytes = tamanho;
+        estatisticas->threads = 1;
+        estatisticas->tempoMs =
+            chrono::duration_cast<chrono::microseconds>(fimLeitura - inicioLeitura).count() / 1000.0;
+    }
+    
+    cout << "Lidas " << celulas.size() << " células do arquivo " << nomeArquivo << " ("
+         << celulas.contar(TipoCelula::Numero) << " números, " << celulas.contar(TipoCelula::Texto)
+         << " textos, " << celulas.contar(TipoCelula::Erro) << " erros, "
+         << celulas.contar(TipoCelula::Vazia) << " vazias)" << endl;
+    return celulas;
+}
+
 bool CSVReader::criarArquivoTeste(const string& nomeArquivo, int numLinhas) {
     ofstream arquivo(nomeArquivo);
     
@@ -70,6 +456,34 @@ bool CSVReader::criarArquivoTeste(const string& nomeArquivo, int numLinhas) {
     return true;
 }
 
+bool CSVReader::criarArquivoTeste(const string& nomeArquivo, uint64_t numLinhas,
+                                  const ParametrosDistribuicao& distribuicao) {
+    ofstream arquivo(nomeArquivo);
+    
+    if (!arquivo.is_open()) {
+        cerr << "Erro ao criar arquivo: " << nomeArquivo << endl;
+        return false;
+    }
+    
+    arquivo << "ID,Valor,Categoria\n" << fixed << setprecision(2);
+    
+    uint64_t id = 0;
+    bool ok = GeradorDistribuicoes::gerarEmFluxo(distribuicao, numLinhas,
+        [&](const double* bloco, size_t quantidade) {
+            for (size_t i = 0; i < quantidade; i++, id++) {
+                arquivo << id + 1 << "," << bloco[i] << ",Cat" << (id % 10) << '\n';
+            }
+            return arquivo.good();
+        });
+    
+    arquivo.close();
+    if (ok) {
+        cout << "Arquivo " << nomeArquivo << " criado com " << numLinhas << " linhas ("
+             << GeradorDistribuicoes::nome(distribuicao.tipo) << ")" << endl;
+    }
+    return ok;
+}
+
 vector<string> CSVReader::split(const string& str, char delimiter) {
     vector<string> tokens;
     stringstream ss(str);
@@ -1,20 +1,80 @@
 #ifndef CSV_READER_H
 #define CSV_READER_H
 
+#include <functional>
 #include <vector>
 #include <string>
 #include <fstream>
+#include "tabela_colunas.h"
+#include "coluna_texto.h"
+#include "coluna_celulas.h"
+#include "gerador_distribuicoes.h"
 
 using namespace std;
 
+// Métricas de carga reportadas pelo leitor mapeado em memória
+struct EstatisticasLeitura {
+    size_t linhas = 0;
+    size_t descartadas = 0;
+    size_t bytes = 0;
+    unsigned threads = 0;
+    double tempoMs = 0;
+    
+    double linhasPorSegundo() const { return tempoMs > 0 ? linhas / (tempoMs / 1000.0) : 0; }
+    double mbPorSegundo() const { return tempoMs > 0 ? (bytes / 1048576.0) / (tempoMs / 1000.0) : 0; }
+};
+
 class CSVReader {
 public:
     static vector<double> lerArquivoCSV(const string& nomeArquivo, int coluna = 0);
+    
+    // Leitor sem cópias: mmap do arquivo, blocos alinhados em quebras de
+    // linha processados em paralelo e from_chars direto dos bytes mapeados.
+    // Campos entre aspas são aceitos (sem quebras de linha internas).
+    static vector<double> lerArquivoCSVMapeado(const string& nomeArquivo, int coluna = 0,
+                                               unsigned numThreads = 0,
+                                               EstatisticasLeitura* estatisticas = nullptr);
+    
+    // Coluna com tipos misturados, classificados como na importação do
+    // Calc (ColunaCelulas::adicionarCampo); nenhuma linha é descartada:
+    // campo vazio ou ausente vira célula vazia
+    static ColunaCelulas lerColunaCelulasCSV(const string& nomeArquivo, int coluna,
+                                             bool cabecalho = true,
+                                             EstatisticasLeitura* estatisticas = nullptr);
+    
+    // Lê várias colunas numéricas de uma vez (linhas com algum campo
+    // inválido são descartadas para manter as colunas alinhadas)
+    static TabelaColunas lerTabelaCSV(const string& nomeArquivo, const vector<int>& colunas);
+    
+    // Coluna de texto numa arena contígua (mmap, uma passada). Com
+    // cabecalho, o campo da primeira linha vira o nome da coluna. Aspas
+    // são removidas ("" vira "); linhas sem o campo ou com ele vazio são
+    // descartadas.
+    static ColunaTexto lerColunaTextoCSV(const string& nomeArquivo, int coluna,
+                                         bool cabecalho = true,
+                                         EstatisticasLeitura* estatisticas = nullptr);
     static bool criarArquivoTeste(const string& nomeArquivo, int numLinhas);
     
+    // Mesmo formato, com valores da distribuição pedida gerados em fluxo
+    // (reprodutível pela semente, sem limite de memória no tamanho)
+    static bool criarArquivoTeste(const string& nomeArquivo, uint64_t numLinhas,
+                                  const ParametrosDistribuicao& distribuicao);
+    
 private:
     static vector<string> split(const string& str, char delimiter);
     static double stringParaDouble(const string& str);
+    
+    // Auxiliares do leitor mapeado: extraem o campo "coluna" de uma linha
+    // [inicio, fim) sem materializar os demais campos
+    static bool extrairCampo(const char* inicio, const char* fim, int coluna,
+                             const char*& campoInicio, const char*& campoFim);
+    static bool converterCampo(const char* inicio, const char* fim, double& valor);
+    
+    // Percorre o campo "coluna" de cada linha do arquivo mapeado, já sem
+    // aspas: visitar(primeiraLinha, encontrado, campo)
+    static bool percorrerCampos(const string& nomeArquivo, int coluna,
+                                const function<void(bool, bool, const string&)>& visitar,
+                                size_t& tamanhoArquivo);
 };
 
 #endif
\ No newline at end of file
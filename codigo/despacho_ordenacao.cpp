@@ -0,0 +1,263 @@
+#include "despacho_ordenacao.h"
+#include "algoritmos_ordenacao.h"
+#include "ordenacao_simd.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+using namespace std;
+
+const char* const DespachoOrdenacao::ARQUIVO_PADRAO = "dados/ajuste_ordenacao.txt";
+
+namespace {
+
+// Limite da pilha explícita do núcleo (e portanto da profundidade)
+const int PROFUNDIDADE_MAXIMA = 256;
+
+struct EstadoDespacho {
+    ConfiguracaoDespacho configuracao;
+    string origem = "padrão";
+};
+
+EstadoDespacho& estado() {
+    static EstadoDespacho atual;
+    return atual;
+}
+
+// Mesma estrutura de ordenacao::introsortUtil (pivô de Lomuto no último
+// elemento, insertion sort nas folhas, heap sort ao esgotar a
+// profundidade), mas sem recursão e com os limiares como parâmetros. A
+// pilha guarda os lados esquerdos; as profundidades nela são estritamente
+// decrescentes, então ela nunca passa da profundidade inicial + 1.
+void nucleoIntrosort(double* dados, ptrdiff_t n, ptrdiff_t limiar, int profundidade) {
+    struct Trecho {
+        ptrdiff_t inicio, fim;
+        int profundidade;
+    };
+    Trecho pilha[PROFUNDIDADE_MAXIMA + 1];
+    int topo = 0;
+    pilha[topo++] = {0, n, profundidade};
+
+    while (topo > 0) {
+        Trecho trecho = pilha[--topo];
+        while (true) {
+            double* base = dados + trecho.inicio;
+            ptrdiff_t tamanho = trecho.fim - trecho.inicio;
+
+            if (tamanho <= limiar) {
+                for (ptrdiff_t i = 1; i < tamanho; i++) {
+                    double chave = base[i];
+                    ptrdiff_t j = i - 1;
+                    while (j >= 0 && chave < base[j]) {
+                        base[j + 1] = base[j];
+                        j--;
+                    }
+                    base[j + 1] = chave;
+                }
+                break;
+            }
+
+            if (trecho.profundidade == 0) {
+                make_heap(base, base + tamanho);
+                sort_heap(base, base + tamanho);
+                break;
+            }
+
+            double pivo = base[tamanho - 1];
+            ptrdiff_t menores = 0;
+            for (ptrdiff_t j = 0; j < tamanho - 1; j++) {
+                if (base[j] < pivo) {
+                    swap(base[menores], base[j]);
+                    menores++;
+                }
+            }
+            swap(base[menores], base[tamanho - 1]);
+
+            trecho.profundidade--;
+            pilha[topo++] = {trecho.inicio, trecho.inicio + menores, trecho.profundidade};
+            trecho.inicio += menores + 1;
+        }
+    }
+}
+
+string aparar(const string& texto) {
+    size_t inicio = texto.find_first_not_of(" \t\r");
+    if (inicio == string::npos) return "";
+    size_t fim = texto.find_last_not_of(" \t\r");
+    return texto.substr(inicio, fim - inicio + 1);
+}
+
+}
+
+bool DespachoOrdenacao::inicializar(const string& arquivoAjuste) {
+    if (!ifstream(arquivoAjuste).good()) {
+        configurar(ConfiguracaoDespacho(), "padrão");
+        return true;
+    }
+
+    ConfiguracaoDespacho configuracaoArquivo;
+    if (!carregar(arquivoAjuste, configuracaoArquivo)) {
+        configurar(ConfiguracaoDespacho(), "padrão");
+        return false;
+    }
+    configurar(configuracaoArquivo, arquivoAjuste);
+    return true;
+}
+
+void DespachoOrdenacao::configurar(const ConfiguracaoDespacho& configuracao, const string& origem) {
+    EstadoDespacho& atual = estado();
+    atual.configuracao = configuracao;
+    atual.origem = origem;
+}
+
+const ConfiguracaoDespacho& DespachoOrdenacao::configuracao() {
+    return estado().configuracao;
+}
+
+string DespachoOrdenacao::descricao() {
+    const EstadoDespacho& atual = estado();
+    ostringstream texto;
+    texto << "Introsort (SIMD) " << (OrdenacaoSIMD::avx2Disponivel() ? "com AVX2" : "escalar (sem AVX2)")
+          << "; folha <= " << atual.configuracao.introsort.limiarInsercao << ", profundidade "
+          << atual.configuracao.introsort.fatorProfundidade << " log2(n)";
+    for (const FaixaDespacho& faixa : atual.configuracao.faixas) {
+        texto << "; " << (faixa.ateTamanho ? "até " + to_string(faixa.ateTamanho) : string("acima"))
+              << ": " << nomeAlgoritmo(faixa.algoritmo);
+    }
+    texto << " [" << atual.origem << "]";
+    return texto.str();
+}
+
+// Formato: linhas "chave: valor"; '#' inicia comentário. "faixa" se
+// repete, uma por linha, com o limite (ou *) e o nome do algoritmo.
+bool DespachoOrdenacao::carregar(const string& nomeArquivo, ConfiguracaoDespacho& configuracao) {
+    ifstream arquivo(nomeArquivo);
+    if (!arquivo.is_open()) {
+        cerr << "Erro ao abrir arquivo de ajuste: " << nomeArquivo << endl;
+        return false;
+    }
+
+    ConfiguracaoDespacho lida;
+    string linha;
+    int numeroLinha = 0;
+    while (getline(arquivo, linha)) {
+        numeroLinha++;
+        linha = aparar(linha.substr(0, linha.find('#')));
+        if (linha.empty()) continue;
+
+        size_t separador = linha.find(':');
+        string chave = aparar(linha.substr(0, separador));
+        string valor = separador == string::npos ? "" : aparar(linha.substr(separador + 1));
+        bool valido = !valor.empty();
+
+        if (chave == "limiar_insercao") {
+            lida.introsort.limiarInsercao = strtol(valor.c_str(), nullptr, 10);
+            valido = valido && lida.introsort.limiarInsercao >= 1;
+        } else if (chave == "fator_profundidade") {
+            lida.introsort.fatorProfundidade = strtod(valor.c_str(), nullptr);
+            valido = valido && lida.introsort.fatorProfundidade > 0;
+        } else if (chave == "faixa") {
+            size_t espaco = valor.find(' ');
+            FaixaDespacho faixa = {0, AlgoritmoDespacho::IntrosortAjustado};
+            string limite = valor.substr(0, espaco);
+            if (limite != "*") faixa.ateTamanho = strtoull(limite.c_str(), nullptr, 10);
+            valido = valido && espaco != string::npos && (limite == "*" || faixa.ateTamanho > 0) &&
+                     algoritmoPorNome(aparar(valor.substr(espaco)), faixa.algoritmo);
+            if (valido) lida.faixas.push_back(faixa);
+        } else {
+            cerr << "Aviso: chave desconhecida no ajuste (" << nomeArquivo << ":" << numeroLinha
+                 << "): " << chave << endl;
+        }
+
+        if (!valido) {
+            cerr << "Erro no arquivo de ajuste " << nomeArquivo << ":" << numeroLinha << ": " << linha
+                 << endl;
+            return false;
+        }
+    }
+
+    configuracao = lida;
+    return true;
+}
+
+bool DespachoOrdenacao::salvar(const string& nomeArquivo, const ConfiguracaoDespacho& configuracao) {
+    ofstream arquivo(nomeArquivo);
+    if (!arquivo.is_open()) {
+        cerr << "Erro ao criar arquivo de ajuste: " << nomeArquivo << endl;
+        return false;
+    }
+
+    arquivo << "# Ajuste de ordenação gerado por benchmark_oficial_simples --autoajuste\n";
+    arquivo << "limiar_insercao: " << configuracao.introsort.limiarInsercao << "\n";
+    arquivo << "fator_profundidade: " << configuracao.introsort.fatorProfundidade << "\n";
+    for (const FaixaDespacho& faixa : configuracao.faixas) {
+        arquivo << "faixa: " << (faixa.ateTamanho ? to_string(faixa.ateTamanho) : string("*")) << " "
+                << nomeAlgoritmo(faixa.algoritmo) << "\n";
+    }
+    return true;
+}
+
+void DespachoOrdenacao::introsort(vector<double>& arr) {
+    introsort(arr, estado().configuracao.introsort);
+}
+
+void DespachoOrdenacao::introsort(vector<double>& arr, const ParametrosIntrosort& parametros) {
+    ptrdiff_t n = arr.size();
+    if (n <= 1) return;
+
+    ptrdiff_t limiar = max<ptrdiff_t>(1, parametros.limiarInsercao);
+    int profundidade = static_cast<int>(parametros.fatorProfundidade * log2(static_cast<double>(n)));
+    profundidade = max(0, min(profundidade, PROFUNDIDADE_MAXIMA));
+    nucleoIntrosort(arr.data(), n, limiar, profundidade);
+}
+
+void DespachoOrdenacao::ordenar(vector<double>& arr) {
+    executar(algoritmoPara(arr.size()), arr);
+}
+
+AlgoritmoDespacho DespachoOrdenacao::algoritmoPara(size_t n) {
+    for (const FaixaDespacho& faixa : estado().configuracao.faixas) {
+        if (faixa.ateTamanho == 0 || n <= faixa.ateTamanho) return faixa.algoritmo;
+    }
+    return AlgoritmoDespacho::IntrosortAjustado;
+}
+
+void DespachoOrdenacao::executar(AlgoritmoDespacho algoritmo, vector<double>& arr) {
+    switch (algoritmo) {
+        case AlgoritmoDespacho::IntrosortAjustado: introsort(arr); break;
+        case AlgoritmoDespacho::IntrosortSIMD: AlgoritmosOrdenacao::introsortSIMD(arr); break;
+        case AlgoritmoDespacho::PDQSort: AlgoritmosOrdenacao::pdqSort(arr); break;
+        case AlgoritmoDespacho::RadixSort: AlgoritmosOrdenacao::radixSort(arr); break;
+        case AlgoritmoDespacho::StdSort: AlgoritmosOrdenacao::stdSort(arr); break;
+    }
+}
+
+// Mesmos nomes do registro de algoritmos do Benchmark
+const char* DespachoOrdenacao::nomeAlgoritmo(AlgoritmoDespacho algoritmo) {
+    switch (algoritmo) {
+        case AlgoritmoDespacho::IntrosortAjustado: return "Introsort (ajustado)";
+        case AlgoritmoDespacho::IntrosortSIMD: return "Introsort (SIMD)";
+        case AlgoritmoDespacho::PDQSort: return "PDQ Sort";
+        case AlgoritmoDespacho::RadixSort: return "Radix Sort";
+        case AlgoritmoDespacho::StdSort: return "std::sort";
+    }
+    return "";
+}
+
+bool DespachoOrdenacao::algoritmoPorNome(const string& nome, AlgoritmoDespacho& algoritmo) {
+    for (AlgoritmoDespacho candidato : algoritmos()) {
+        if (nome == nomeAlgoritmo(candidato)) {
+            algoritmo = candidato;
+            return true;
+        }
+    }
+    return false;
+}
+
+vector<AlgoritmoDespacho> DespachoOrdenacao::algoritmos() {
+    return {AlgoritmoDespacho::IntrosortAjustado, AlgoritmoDespacho::IntrosortSIMD,
+            AlgoritmoDespacho::PDQSort, AlgoritmoDespacho::RadixSort, AlgoritmoDespacho::StdSort};
+}
@@ -0,0 +1,66 @@
+#ifndef DESPACHO_ORDENACAO_H
+#define DESPACHO_ORDENACAO_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+// Os palpites fixos do introsort manual (folha <= 16, 2 log2 n) como
+// parâmetros de execução
+struct ParametrosIntrosort {
+    ptrdiff_t limiarInsercao = 16;      // folhas com até isso vão para o insertion sort
+    double fatorProfundidade = 2.0;     // limite de profundidade = fator * log2(n)
+};
+
+// Algoritmos que o despacho por tamanho pode escolher
+enum class AlgoritmoDespacho { IntrosortAjustado, IntrosortSIMD, PDQSort, RadixSort, StdSort };
+
+// Arrays com até 'ateTamanho' elementos (0 = sem limite) usam 'algoritmo'
+struct FaixaDespacho {
+    size_t ateTamanho;
+    AlgoritmoDespacho algoritmo;
+};
+
+struct ConfiguracaoDespacho {
+    ParametrosIntrosort introsort;
+    vector<FaixaDespacho> faixas;   // crescentes; vazio = sempre o introsort ajustado
+};
+
+// Escolha, na inicialização, dos limiares do introsort e do algoritmo por
+// faixa de tamanho. O arquivo de ajuste (gerado por --autoajuste) dá os
+// parâmetros; sem arquivo valem os padrões do introsort manual. O caminho
+// vetorial é o Introsort (SIMD), que detecta AVX2 em tempo de execução.
+class DespachoOrdenacao {
+public:
+    static const char* const ARQUIVO_PADRAO;
+
+    // Lê o arquivo (se existir) e fixa a configuração ativa. Retorna false
+    // só se o arquivo existir e for inválido.
+    static bool inicializar(const string& arquivoAjuste = ARQUIVO_PADRAO);
+    static void configurar(const ConfiguracaoDespacho& configuracao, const string& origem);
+    static const ConfiguracaoDespacho& configuracao();
+
+    // Decisão de despacho numa linha: instruções vetoriais detectadas,
+    // limiares, faixas e de onde vieram
+    static string descricao();
+
+    static bool carregar(const string& nomeArquivo, ConfiguracaoDespacho& configuracao);
+    static bool salvar(const string& nomeArquivo, const ConfiguracaoDespacho& configuracao);
+
+    // Introsort com os limiares ativos
+    static void introsort(vector<double>& arr);
+    static void introsort(vector<double>& arr, const ParametrosIntrosort& parametros);
+
+    // Algoritmo da faixa de tamanho de arr, segundo o ajuste
+    static void ordenar(vector<double>& arr);
+    static AlgoritmoDespacho algoritmoPara(size_t n);
+    static void executar(AlgoritmoDespacho algoritmo, vector<double>& arr);
+
+    static const char* nomeAlgoritmo(AlgoritmoDespacho algoritmo);
+    static bool algoritmoPorNome(const string& nome, AlgoritmoDespacho& algoritmo);
+    static vector<AlgoritmoDespacho> algoritmos();
+};
+
+#endif
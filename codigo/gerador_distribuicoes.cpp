@@ -0,0 +1,252 @@
+#include "gerador_distribuicoes.h"
+#include "ordenacao_generica.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <iostream>
+#include <random>
+#include <unordered_map>
+
+using namespace std;
+
+namespace {
+
+// Estado de uma distribuição gerada em ordem, posição a posição
+class FluxoDistribuicao {
+public:
+    FluxoDistribuicao(const ParametrosDistribuicao& parametros, uint64_t n)
+        : parametros(parametros), n(n), gerador(parametros.semente) {
+        switch (parametros.tipo) {
+            case Distribuicao::QuaseOrdenada: prepararTrocas(); break;
+            case Distribuicao::PoucosValores: prepararValores(); break;
+            case Distribuicao::Zipf: prepararZipf(); break;
+            case Distribuicao::AntiQuicksort:
+                adversario = GeradorDistribuicoes::antiQuicksort(n);
+                break;
+            default: break;
+        }
+    }
+
+    void preencher(double* destino, size_t quantidade) {
+        uint64_t inicio = posicao;
+        posicao += quantidade;
+
+        switch (parametros.tipo) {
+            case Distribuicao::Aleatoria: {
+                uniform_real_distribution<double> uniforme(1.0, 100000.0);
+                for (size_t i = 0; i < quantidade; i++) destino[i] = uniforme(gerador);
+                break;
+            }
+            case Distribuicao::Ordenada:
+                for (size_t i = 0; i < quantidade; i++) destino[i] = inicio + i;
+                break;
+            case Distribuicao::Reversa:
+                for (size_t i = 0; i < quantidade; i++) destino[i] = n - 1 - (inicio + i);
+                break;
+            case Distribuicao::QuaseOrdenada:
+                for (size_t i = 0; i < quantidade; i++) destino[i] = inicio + i;
+                // Trocas ordenadas por posição: só as que caem neste bloco
+                while (proximaTroca < trocas.size() && trocas[proximaTroca].first < posicao) {
+                    destino[trocas[proximaTroca].first - inicio] = trocas[proximaTroca].second;
+                    proximaTroca++;
+                }
+                break;
+            case Distribuicao::Orgao:
+                for (size_t i = 0; i < quantidade; i++) {
+                    uint64_t j = inicio + i;
+                    destino[i] = j < (n + 1) / 2 ? j : n - 1 - j;
+                }
+                break;
+            case Distribuicao::DenteDeSerra: {
+                uint64_t periodo = max<size_t>(1, parametros.periodo);
+                for (size_t i = 0; i < quantidade; i++) destino[i] = (inicio + i) % periodo;
+                break;
+            }
+            case Distribuicao::PoucosValores: {
+                uniform_int_distribution<size_t> indice(0, valores.size() - 1);
+                for (size_t i = 0; i < quantidade; i++) destino[i] = valores[indice(gerador)];
+                break;
+            }
+            case Distribuicao::TodosIguais:
+                fill(destino, destino + quantidade, 1.0);
+                break;
+            case Distribuicao::Zipf: {
+                // Inversão da CDF por busca binária
+                uniform_real_distribution<double> uniforme(0.0, 1.0);
+                for (size_t i = 0; i < quantidade; i++) {
+                    auto posto = upper_bound(cdfZipf.begin(), cdfZipf.end() - 1, uniforme(gerador));
+                    destino[i] = static_cast<double>(posto - cdfZipf.begin() + 1);
+                }
+                break;
+            }
+            case Distribuicao::AntiQuicksort:
+                copy(adversario.begin() + inicio, adversario.begin() + inicio + quantidade, destino);
+                break;
+        }
+    }
+
+    bool valido() const {
+        return parametros.tipo != Distribuicao::AntiQuicksort || adversario.size() == n;
+    }
+
+private:
+    const ParametrosDistribuicao& parametros;
+    uint64_t n;
+    uint64_t posicao = 0;
+    mt19937_64 gerador;
+
+    vector<pair<uint64_t, double>> trocas;
+    size_t proximaTroca = 0;
+    vector<double> valores;
+    vector<double> cdfZipf;
+    vector<double> adversario;
+
+    // As trocas são aplicadas em sequência sobre um mapa esparso
+    // posição -> valor (o valor padrão de uma posição é ela mesma)
+    void prepararTrocas() {
+        if (n < 2) return;
+        unordered_map<uint64_t, double> alteradas;
+        uniform_int_distribution<uint64_t> sorteio(0, n - 1);
+        auto valorEm = [&](uint64_t p) {
+            auto it = alteradas.find(p);
+            return it == alteradas.end() ? static_cast<double>(p) : it->second;
+        };
+
+        for (size_t t = 0; t < parametros.trocas; t++) {
+            uint64_t a = sorteio(gerador);
+            uint64_t b = sorteio(gerador);
+            double valorA = valorEm(a);
+            alteradas[a] = valorEm(b);
+            alteradas[b] = valorA;
+        }
+
+        trocas.assign(alteradas.begin(), alteradas.end());
+        sort(trocas.begin(), trocas.end());
+    }
+
+    void prepararValores() {
+        uniform_real_distribution<double> uniforme(1.0, 100000.0);
+        valores.resize(max<size_t>(1, parametros.valoresDistintos));
+        for (double& valor : valores) valor = round(uniforme(gerador));
+    }
+
+    void prepararZipf() {
+        cdfZipf.resize(max<size_t>(1, parametros.universoZipf));
+        double soma = 0;
+        for (size_t k = 0; k < cdfZipf.size(); k++) {
+            soma += 1.0 / pow(static_cast<double>(k + 1), parametros.expoenteZipf);
+            cdfZipf[k] = soma;
+        }
+        for (double& acumulado : cdfZipf) acumulado /= soma;
+    }
+};
+
+const pair<Distribuicao, const char*> NOMES[] = {
+    {Distribuicao::Aleatoria, "aleatoria"},
+    {Distribuicao::Ordenada, "ordenada"},
+    {Distribuicao::Reversa, "reversa"},
+    {Distribuicao::QuaseOrdenada, "quase-ordenada"},
+    {Distribuicao::Orgao, "orgao"},
+    {Distribuicao::DenteDeSerra, "dente-de-serra"},
+    {Distribuicao::PoucosValores, "poucos-valores"},
+    {Distribuicao::TodosIguais, "todos-iguais"},
+    {Distribuicao::Zipf, "zipf"},
+    {Distribuicao::AntiQuicksort, "antiqsort"}};
+
+}
+
+vector<double> GeradorDistribuicoes::gerar(const ParametrosDistribuicao& parametros, size_t n) {
+    vector<double> dados;
+    dados.reserve(n);
+    gerarEmFluxo(parametros, n, [&](const double* bloco, size_t quantidade) {
+        dados.insert(dados.end(), bloco, bloco + quantidade);
+        return true;
+    });
+    return dados;
+}
+
+bool GeradorDistribuicoes::gerarEmFluxo(const ParametrosDistribuicao& parametros, uint64_t n,
+                                        const function<bool(const double*, size_t)>& consumidor,
+                                        size_t tamanhoBloco) {
+    FluxoDistribuicao fluxo(parametros, n);
+    if (!fluxo.valido()) return false;
+
+    vector<double> bloco(max<size_t>(1, min<uint64_t>(tamanhoBloco, n)));
+    for (uint64_t gerados = 0; gerados < n;) {
+        size_t quantidade = static_cast<size_t>(min<uint64_t>(bloco.size(), n - gerados));
+        fluxo.preencher(bloco.data(), quantidade);
+        if (!consumidor(bloco.data(), quantidade)) return false;
+        gerados += quantidade;
+    }
+    return true;
+}
+
+bool GeradorDistribuicoes::gravarArquivoBruto(const ParametrosDistribuicao& parametros, uint64_t n,
+                                              const string& nomeArquivo) {
+    FILE* arquivo = fopen(nomeArquivo.c_str(), "wb");
+    if (!arquivo) {
+        cerr << "Erro ao criar arquivo: " << nomeArquivo << endl;
+        return false;
+    }
+
+    bool ok = gerarEmFluxo(parametros, n, [&](const double* bloco, size_t quantidade) {
+        return fwrite(bloco, sizeof(double), quantidade, arquivo) == quantidade;
+    });
+    return fclose(arquivo) == 0 && ok;
+}
+
+vector<double> GeradorDistribuicoes::antiQuicksort(size_t n) {
+    if (n > LIMITE_ANTIQUICKSORT) {
+        cerr << "antiqsort: " << n << " elementos excede o limite de "
+             << LIMITE_ANTIQUICKSORT << " (o adversário é quadrático)" << endl;
+        return {};
+    }
+
+    // Todos começam como "gás" (valor ainda indefinido, maior que qualquer
+    // sólido). Quando dois gases são comparados, um deles é solidificado
+    // com o próximo menor valor; o candidato a pivô é o preferido.
+    const size_t gas = n > 0 ? n - 1 : 0;
+    vector<size_t> valor(n, gas);
+    vector<size_t> indices(n);
+    for (size_t i = 0; i < n; i++) indices[i] = i;
+    size_t solidos = 0;
+    size_t candidato = 0;
+
+    auto comparador = [&](size_t x, size_t y) {
+        if (valor[x] == gas && valor[y] == gas) {
+            if (x == candidato) valor[x] = solidos++;
+            else valor[y] = solidos++;
+        }
+        if (valor[x] == gas) candidato = x;
+        else if (valor[y] == gas) candidato = y;
+        return valor[x] < valor[y];
+    };
+
+    // Mesma partição (Lomuto, pivô no último) de AlgoritmosOrdenacao::quickSort
+    ordenacao::quickSort(indices.begin(), indices.end(), comparador);
+
+    return vector<double>(valor.begin(), valor.end());
+}
+
+string GeradorDistribuicoes::nome(Distribuicao tipo) {
+    for (const auto& entrada : NOMES) {
+        if (entrada.first == tipo) return entrada.second;
+    }
+    return "?";
+}
+
+bool GeradorDistribuicoes::porNome(const string& nome, Distribuicao& tipo) {
+    for (const auto& entrada : NOMES) {
+        if (nome == entrada.second) {
+            tipo = entrada.first;
+            return true;
+        }
+    }
+    return false;
+}
+
+vector<Distribuicao> GeradorDistribuicoes::todas() {
+    vector<Distribuicao> tipos;
+    for (const auto& entrada : NOMES) tipos.push_back(entrada.first);
+    return tipos;
+}
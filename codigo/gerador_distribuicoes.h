@@ -0,0 +1,66 @@
+#ifndef GERADOR_DISTRIBUICOES_H
+#define GERADOR_DISTRIBUICOES_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+enum class Distribuicao {
+    Aleatoria,        // uniforme em [1, 100000), como criarArquivoTeste
+    Ordenada,
+    Reversa,
+    QuaseOrdenada,    // ordenada com 'trocas' pares trocados ao acaso
+    Orgao,            // sobe até o meio e desce (organ pipe)
+    DenteDeSerra,     // 0..periodo-1 repetido
+    PoucosValores,    // 'valoresDistintos' valores sorteados
+    TodosIguais,
+    Zipf,             // posto k em [1, universoZipf] com P(k) ~ 1/k^expoente
+    AntiQuicksort     // adversário de McIlroy contra a partição de Lomuto
+};
+
+struct ParametrosDistribuicao {
+    Distribuicao tipo = Distribuicao::Aleatoria;
+    uint64_t semente = 42;
+    size_t trocas = 100;
+    size_t periodo = 1000;
+    size_t valoresDistintos = 16;
+    size_t universoZipf = 100000;
+    double expoenteZipf = 1.1;
+};
+
+// Geradores de entrada reprodutíveis (mesma semente, mesma sequência).
+// Todas as distribuições, exceto AntiQuicksort, são geradas em fluxo com
+// memória O(bloco + trocas), então servem para 10^8+ elementos direto em
+// arquivo. O AntiQuicksort precisa executar o Quick Sort (quadrático
+// contra o próprio adversário) e fica limitado a LIMITE_ANTIQUICKSORT.
+class GeradorDistribuicoes {
+public:
+    static const size_t LIMITE_ANTIQUICKSORT = 1 << 17;
+
+    static vector<double> gerar(const ParametrosDistribuicao& parametros, size_t n);
+
+    // Entrega os valores em blocos de até tamanhoBloco; o consumidor pode
+    // interromper retornando false
+    static bool gerarEmFluxo(const ParametrosDistribuicao& parametros, uint64_t n,
+                             const function<bool(const double*, size_t)>& consumidor,
+                             size_t tamanhoBloco = 1 << 16);
+
+    // Arquivo binário bruto de doubles (entrada da OrdenacaoExterna)
+    static bool gravarArquivoBruto(const ParametrosDistribuicao& parametros, uint64_t n,
+                                   const string& nomeArquivo);
+
+    // Entrada construída pelo adversário "antiqsort" (McIlroy, 1999): o
+    // Quick Sort é executado sobre índices com um comparador que decide
+    // os valores sob demanda, sempre tornando o pivô o menor possível
+    static vector<double> antiQuicksort(size_t n);
+
+    static string nome(Distribuicao tipo);
+    static bool porNome(const string& nome, Distribuicao& tipo);
+    static vector<Distribuicao> todas();
+};
+
+#endif
@@ -8,6 +8,7 @@ import pandas as pd
 import matplotlib.pyplot as plt
 import seaborn as sns
 import numpy as np
+import sys
 from pathlib import Path
 
 def configurar_estilo():
@@ -33,7 +34,7 @@ def carregar_dados(arquivo=None):
     
     for arquivo_teste in arquivos_possiveis:
         try:
-            df = pd.read_csv(arquivo_teste)
+            df = pd.read_csv(arquivo_teste, comment='#')
             print(f"✓ Dados carregados de: {arquivo_teste}")
             print(f"✓ Total de registros: {len(df)}")
             return df
@@ -54,8 +55,13 @@ def gerar_grafico_comparacao(df, salvar=True):
     # Gráfico de linhas
     for algoritmo in df_sucesso['Algoritmo'].unique():
         dados_alg = df_sucesso[df_sucesso['Algoritmo'] == algoritmo]
-        plt.plot(dados_alg['Tamanho_Array'], dados_alg['Tempo_ms'], 
+        linha, = plt.plot(dados_alg['Tamanho_Array'], dados_alg['Tempo_ms'], 
                 marker='o', linewidth=2, label=algoritmo)
+        
+        # Faixa do intervalo de confiança da mediana (resultados com repetições)
+        if 'IC_Inf_ms' in dados_alg.columns:
+            plt.fill_between(dados_alg['Tamanho_Array'], dados_alg['IC_Inf_ms'],
+                             dados_alg['IC_Sup_ms'], color=linha.get_color(), alpha=0.2)
     
     # Configurar eixo X para mostrar todos os tamanhos importantes
     tamanhos_unicos = sorted(df_sucesso['Tamanho_Array'].unique())
@@ -194,6 +200,111 @@ def gerar_analise_complexidade(df, salvar=True):
     
     plt.show()
 
+def gerar_grafico_contadores(df, salvar=True):
+    """Gera gráficos dos contadores de hardware (perf_event_open) por tamanho"""
+    metricas = [('IPC', 'IPC'),
+                ('Miss_L1d', 'Misses L1d por elemento'),
+                ('Miss_LLC', 'Misses LLC por elemento'),
+                ('Miss_Desvio', 'Desvios mal previstos por elemento'),
+                ('Miss_dTLB', 'Misses dTLB por elemento'),
+                ('Instrucoes', 'Instruções por elemento')]
+    metricas = [(coluna, titulo) for coluna, titulo in metricas
+                if coluna in df.columns and df[coluna].notna().any()]
+    
+    if not metricas:
+        print("Sem contadores de hardware nos resultados")
+        return
+    
+    df_sucesso = df[df['Sucesso'] == 'Sim'].copy()
+    colunas = 3
+    linhas = (len(metricas) + colunas - 1) // colunas
+    fig, eixos = plt.subplots(linhas, colunas, figsize=(18, 5 * linhas), squeeze=False)
+    
+    for eixo, (coluna, titulo) in zip(eixos.flat, metricas):
+        for algoritmo in df_sucesso['Algoritmo'].unique():
+            dados_alg = df_sucesso[(df_sucesso['Algoritmo'] == algoritmo) &
+                                   df_sucesso[coluna].notna()]
+            if dados_alg.empty:
+                continue
+            
+            # Contagens absolutas normalizadas por elemento; IPC já é razão
+            valores = dados_alg[coluna]
+            if coluna != 'IPC':
+                valores = valores / dados_alg['Tamanho_Array']
+            eixo.plot(dados_alg['Tamanho_Array'], valores, marker='o', label=algoritmo)
+        
+        eixo.set_title(titulo)
+        eixo.set_xlabel('Tamanho do Array (elementos)')
+        eixo.set_xscale('log')
+        eixo.grid(True, alpha=0.3)
+    
+    for eixo in list(eixos.flat)[len(metricas):]:
+        eixo.set_visible(False)
+    
+    eixos.flat[0].legend(fontsize=8)
+    plt.tight_layout()
+    
+    if salvar:
+        plt.savefig('contadores_hardware.png', dpi=300, bbox_inches='tight')
+        print("Gráfico salvo: contadores_hardware.png")
+    
+    plt.show()
+
+def gerar_grafico_operacoes(df, salvar=True):
+    """Comparações normalizadas por n log2 n e por n² (curvas teóricas)"""
+    if 'Comparacoes' not in df.columns or df['Comparacoes'].isna().all():
+        print("Sem contagem de operações nos resultados")
+        return
+    
+    df_contado = df[df['Comparacoes'].notna()].drop_duplicates(['Algoritmo', 'Tamanho_Array'])
+    fig, (eixo_nlogn, eixo_n2) = plt.subplots(1, 2, figsize=(16, 6))
+    
+    # Curva plana em C/(n log n) = crescimento n log n; em C/n² = quadrático
+    for algoritmo in df_contado['Algoritmo'].unique():
+        dados_alg = df_contado[df_contado['Algoritmo'] == algoritmo].sort_values('Tamanho_Array')
+        n = dados_alg['Tamanho_Array']
+        eixo_nlogn.plot(n, dados_alg['Comparacoes'] / (n * np.log2(n)), marker='o', label=algoritmo)
+        eixo_n2.plot(n, dados_alg['Comparacoes'] / (n * n), marker='o', label=algoritmo)
+    
+    eixo_nlogn.set_title('Comparações / (n log2 n)')
+    eixo_n2.set_title('Comparações / n²')
+    for eixo in (eixo_nlogn, eixo_n2):
+        eixo.set_xlabel('Tamanho do Array (elementos)')
+        eixo.set_xscale('log')
+        eixo.set_yscale('log')
+        eixo.grid(True, alpha=0.3)
+    eixo_nlogn.legend()
+    plt.tight_layout()
+    
+    if salvar:
+        plt.savefig('contagem_operacoes.png', dpi=300, bbox_inches='tight')
+        print("Gráfico salvo: contagem_operacoes.png")
+    
+    plt.show()
+
+def gerar_grafico_distribuicoes(df, salvar=True):
+    """Gera mapa de calor algoritmo x distribuição (varredura sintética)"""
+    df_sucesso = df[(df['Sucesso'] == 'Sim') & df['Distribuicao'].notna()].copy()
+    
+    for tamanho in sorted(df_sucesso['Tamanho_Array'].unique()):
+        dados_tamanho = df_sucesso[df_sucesso['Tamanho_Array'] == tamanho]
+        tabela = dados_tamanho.pivot_table(index='Algoritmo', columns='Distribuicao',
+                                           values='Tempo_ms', aggfunc='median')
+        
+        plt.figure(figsize=(14, 8))
+        # Escala log: os casos quadráticos dominariam a escala linear
+        sns.heatmap(np.log10(tabela), annot=tabela.round(2), fmt='', cmap='rocket_r',
+                    cbar_kws={'label': 'log10(Tempo ms)'})
+        plt.title(f'Mediana (ms) por Distribuição - {int(tamanho):,} elementos')
+        plt.tight_layout()
+        
+        if salvar:
+            nome_arquivo = f'grafico_distribuicoes_{int(tamanho)}.png'
+            plt.savefig(nome_arquivo, dpi=300, bbox_inches='tight')
+            print(f"Gráfico salvo: {nome_arquivo}")
+        
+        plt.show()
+
 def gerar_relatorio_completo(df):
     """Gera relatório completo em texto"""
     with open('relatorio_benchmark.txt', 'w', encoding='utf-8') as f:
@@ -231,7 +342,7 @@ def main():
     configurar_estilo()
     
     # Carregar dados
-    df = carregar_dados()
+    df = carregar_dados(sys.argv[1] if len(sys.argv) > 1 else None)
     if df is None:
         return
     
@@ -240,6 +351,13 @@ def main():
     print(f"\nAlgoritmos: {df['Algoritmo'].unique()}")
     print(f"Tamanhos: {sorted(df['Tamanho_Array'].unique())}")
     
+    # Resultados da varredura sintética (--varredura): um mapa de calor por
+    # tamanho; as demais análises supõem uma única entrada por tamanho
+    if 'Distribuicao' in df.columns and df['Distribuicao'].notna().any():
+        print("\nGerando gráficos por distribuição...")
+        gerar_grafico_distribuicoes(df)
+        return
+    
     # Gerar análises
     print("\n1. Gerando gráfico de comparação...")
     gerar_grafico_comparacao(df)
@@ -250,7 +368,13 @@ def main():
     print("\n3. Gerando tabela resumo...")
     tabela = gerar_tabela_resumo(df)
     
-    print("\n4. Gerando relatório completo...")
+    print("\n4. Gerando gráficos dos contadores de hardware...")
+    gerar_grafico_contadores(df)
+    
+    print("\n5. Gerando gráfico da contagem de operações...")
+    gerar_grafico_operacoes(df)
+    
+    print("\n6. Gerando relatório completo...")
     gerar_relatorio_completo(df)
     
     print("\n=== ANÁLISE CONCLUÍDA ===")
@@ -260,6 +384,7 @@ def main():
     print("- tabela_resumo.csv")
     print("- speedup_stdSort.csv")
     print("- analise_complexidade.png")
+    print("- contadores_hardware.png")
     print("- relatorio_benchmark.txt")
 
 if __name__ == "__main__":
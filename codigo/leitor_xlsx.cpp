@@ -0,0 +1,726 @@
+#include "leitor_xlsx.h"
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <zlib.h>
+
+using namespace std;
+
+namespace {
+
+const char* const PLANILHA_XML = "xl/worksheets/sheet1.xml";
+const char* const SHARED_STRINGS_XML = "xl/sharedStrings.xml";
+const size_t TAMANHO_BLOCO = 1 << 16;
+
+uint16_t lerU16(const unsigned char* p) { return p[0] | (p[1] << 8); }
+uint32_t lerU32(const unsigned char* p) { return lerU16(p) | (uint32_t(lerU16(p + 2)) << 16); }
+
+// Tokenizador XML incremental: recebe blocos arbitrários e chama os
+// tratadores para cada marca de abertura, fechamento e trecho de texto
+class ParserXML {
+public:
+    function<void(const string& nome, const string& marca, bool autoFechada)> aoAbrir;
+    function<void(const string& nome)> aoFechar;
+    function<void(const char* texto, size_t tamanho)> aoTexto;
+
+    void alimentar(const char* dados, size_t tamanho) {
+        pendente.append(dados, tamanho);
+        size_t pos = 0;
+
+        while (pos < pendente.size()) {
+            size_t abre = pendente.find('<', pos);
+            if (abre == string::npos) {
+                aoTexto(pendente.data() + pos, pendente.size() - pos);
+                pos = pendente.size();
+                break;
+            }
+            if (abre > pos) {
+                aoTexto(pendente.data() + pos, abre - pos);
+            }
+
+            size_t fecha = pendente.find('>', abre);
+            if (fecha == string::npos) {
+                pos = abre;
+                break;
+            }
+
+            processarMarca(pendente.substr(abre + 1, fecha - abre - 1));
+            pos = fecha + 1;
+        }
+        pendente.erase(0, pos);
+    }
+
+private:
+    string pendente;
+
+    // Remove o prefixo de namespace (x:c -> c)
+    static string nomeLocal(const string& nome) {
+        size_t doisPontos = nome.find(':');
+        return doisPontos == string::npos ? nome : nome.substr(doisPontos + 1);
+    }
+
+    void processarMarca(const string& marca) {
+        if (marca.empty() || marca[0] == '?' || marca[0] == '!') return;
+
+        if (marca[0] == '/') {
+            aoFechar(nomeLocal(marca.substr(1, marca.find_first_of(" \t\r\n", 1) - 1)));
+            return;
+        }
+
+        bool autoFechada = marca.back() == '/';
+        size_t fimNome = marca.find_first_of(" \t\r\n/");
+        aoAbrir(nomeLocal(marca.substr(0, fimNome)), marca, autoFechada);
+    }
+};
+
+// Valor do atributo nome="..." dentro da marca
+string atributo(const string& marca, const char* nome) {
+    string procura = string(" ") + nome + "=\"";
+    size_t inicio = marca.find(procura);
+    if (inicio == string::npos) return "";
+    inicio += procura.size();
+    size_t fim = marca.find('"', inicio);
+    return marca.substr(inicio, fim - inicio);
+}
+
+bool converterNumero(const string& texto, double& valor) {
+    const char* inicio = texto.data();
+    const char* fim = inicio + texto.size();
+    while (inicio < fim && isspace(static_cast<unsigned char>(*inicio))) inicio++;
+    while (fim > inicio && isspace(static_cast<unsigned char>(fim[-1]))) fim--;
+    if (inicio < fim && *inicio == '+') inicio++;
+    if (inicio == fim) return false;
+
+    auto resultado = from_chars(inicio, fim, valor);
+    return resultado.ec == errc() && resultado.ptr == fim;
+}
+
+// Substitui as entidades XML (&amp; &lt; &gt; &quot; &apos; &#N; &#xN;)
+// pelos caracteres, em UTF-8
+void decodificarEntidades(string& texto) {
+    if (texto.find('&') == string::npos) return;
+    string saida;
+    saida.reserve(texto.size());
+    for (size_t i = 0; i < texto.size(); i++) {
+        size_t fim = texto[i] == '&' ? texto.find(';', i) : string::npos;
+        if (fim == string::npos) {
+            saida += texto[i];
+            continue;
+        }
+        string entidade = texto.substr(i + 1, fim - i - 1);
+        uint32_t codigo = 0;
+        if (entidade == "amp") codigo = '&';
+        else if (entidade == "lt") codigo = '<';
+        else if (entidade == "gt") codigo = '>';
+        else if (entidade == "quot") codigo = '"';
+        else if (entidade == "apos") codigo = '\'';
+        else if (entidade.size() > 1 && entidade[0] == '#') {
+            bool hexa = entidade[1] == 'x';
+            codigo = strtoul(entidade.c_str() + (hexa ? 2 : 1), nullptr, hexa ? 16 : 10);
+        }
+        if (codigo == 0) {
+            saida += texto[i];
+            continue;
+        }
+        if (codigo < 0x80) {
+            saida += static_cast<char>(codigo);
+        } else if (codigo < 0x800) {
+            saida += static_cast<char>(0xC0 | (codigo >> 6));
+            saida += static_cast<char>(0x80 | (codigo & 0x3F));
+        } else if (codigo < 0x10000) {
+            saida += static_cast<char>(0xE0 | (codigo >> 12));
+            saida += static_cast<char>(0x80 | ((codigo >> 6) & 0x3F));
+            saida += static_cast<char>(0x80 | (codigo & 0x3F));
+        } else {
+            saida += static_cast<char>(0xF0 | (codigo >> 18));
+            saida += static_cast<char>(0x80 | ((codigo >> 12) & 0x3F));
+            saida += static_cast<char>(0x80 | ((codigo >> 6) & 0x3F));
+            saida += static_cast<char>(0x80 | (codigo & 0x3F));
+        }
+        i = fim;
+    }
+    texto.swap(saida);
+}
+
+// Célula que aponta para a tabela de shared strings, resolvida depois
+struct StringPendente {
+    size_t linha;
+    size_t coluna;
+    uint32_t indice;
+};
+
+}
+
+int LeitorXLSX::colunaDaReferencia(const string& referencia) {
+    int coluna = 0;
+    for (char c : referencia) {
+        if (c < 'A' || c > 'Z') break;
+        coluna = coluna * 26 + (c - 'A' + 1);
+    }
+    return coluna - 1;
+}
+
+bool LeitorXLSX::lerDiretorioZip(ifstream& arquivo, vector<EntradaZip>& entradas) {
+    arquivo.seekg(0, ios::end);
+    size_t tamanho = arquivo.tellg();
+    if (tamanho < 22) return false;
+
+    // O registro de fim do diretório central fica nos últimos 64 KiB + 22 bytes
+    size_t janela = min<size_t>(tamanho, 65557);
+    vector<unsigned char> fim(janela);
+    arquivo.seekg(tamanho - janela);
+    arquivo.read(reinterpret_cast<char*>(fim.data()), janela);
+
+    size_t registro = string::npos;
+    for (size_t i = janela - 22 + 1; i-- > 0;) {
+        if (lerU32(&fim[i]) == 0x06054b50) {
+            registro = i;
+            break;
+        }
+    }
+    if (registro == string::npos) return false;
+
+    uint16_t numEntradas = lerU16(&fim[registro + 10]);
+    uint32_t tamanhoDiretorio = lerU32(&fim[registro + 12]);
+    uint32_t inicioDiretorio = lerU32(&fim[registro + 16]);
+
+    vector<unsigned char> diretorio(tamanhoDiretorio);
+    arquivo.seekg(inicioDiretorio);
+    arquivo.read(reinterpret_cast<char*>(diretorio.data()), tamanhoDiretorio);
+    if (!arquivo) return false;
+
+    size_t pos = 0;
+    for (uint16_t i = 0; i < numEntradas && pos + 46 <= diretorio.size(); i++) {
+        const unsigned char* p = &diretorio[pos];
+        if (lerU32(p) != 0x02014b50) return false;
+
+        EntradaZip entrada;
+        entrada.metodo = lerU16(p + 10);
+        entrada.tamanhoCompactado = lerU32(p + 20);
+        entrada.tamanhoOriginal = lerU32(p + 24);
+        uint16_t tamanhoNome = lerU16(p + 28);
+        uint16_t tamanhoExtra = lerU16(p + 30);
+        uint16_t tamanhoComentario = lerU16(p + 32);
+        entrada.deslocamentoCabecalho = lerU32(p + 42);
+        entrada.nome.assign(reinterpret_cast<const char*>(p + 46), tamanhoNome);
+
+        entradas.push_back(entrada);
+        pos += 46 + tamanhoNome + tamanhoExtra + tamanhoComentario;
+    }
+    return true;
+}
+
+bool LeitorXLSX::extrairEmFluxo(ifstream& arquivo, const EntradaZip& entrada,
+                                const function<bool(const char*, size_t)>& consumidor) {
+    // Cabeçalho local: os tamanhos de nome/extra podem diferir do diretório
+    unsigned char local[30];
+    arquivo.clear();
+    arquivo.seekg(entrada.deslocamentoCabecalho);
+    arquivo.read(reinterpret_cast<char*>(local), sizeof(local));
+    if (!arquivo || lerU32(local) != 0x04034b50) return false;
+    arquivo.seekg(lerU16(local + 26) + lerU16(local + 28), ios::cur);
+
+    vector<char> entradaBloco(TAMANHO_BLOCO);
+    vector<char> saidaBloco(TAMANHO_BLOCO);
+    size_t restante = entrada.tamanhoCompactado;
+
+    if (entrada.metodo == 0) {
+        while (restante > 0) {
+            size_t ler = min(restante, TAMANHO_BLOCO);
+            arquivo.read(entradaBloco.data(), ler);
+            if (!arquivo) return false;
+            restante -= ler;
+            if (!consumidor(entradaBloco.data(), ler)) return true;
+        }
+        return true;
+    }
+
+    if (entrada.metodo != 8) {
+        cerr << "Método de compressão não suportado em " << entrada.nome << endl;
+        return false;
+    }
+
+    z_stream fluxo = {};
+    if (inflateInit2(&fluxo, -MAX_WBITS) != Z_OK) return false;
+
+    int estado = Z_OK;
+    bool continuar = true;
+    while (continuar && estado != Z_STREAM_END && restante > 0) {
+        size_t ler = min(restante, TAMANHO_BLOCO);
+        arquivo.read(entradaBloco.data(), ler);
+        if (!arquivo) break;
+        restante -= ler;
+
+        fluxo.next_in = reinterpret_cast<Bytef*>(entradaBloco.data());
+        fluxo.avail_in = ler;
+
+        do {
+            fluxo.next_out = reinterpret_cast<Bytef*>(saidaBloco.data());
+            fluxo.avail_out = TAMANHO_BLOCO;
+            estado = inflate(&fluxo, Z_NO_FLUSH);
+            // Sem progresso com a entrada atual (o bloco anterior de saída
+            // terminou junto com ela): lê o próximo trecho, como no zpipe
+            if (estado == Z_BUF_ERROR) break;
+            if (estado != Z_OK && estado != Z_STREAM_END) {
+                inflateEnd(&fluxo);
+                return false;
+            }
+            size_t produzidos = TAMANHO_BLOCO - fluxo.avail_out;
+            if (produzidos > 0 && !consumidor(saidaBloco.data(), produzidos)) {
+                continuar = false;
+                break;
+            }
+        } while (fluxo.avail_out == 0 && estado != Z_STREAM_END);
+    }
+
+    inflateEnd(&fluxo);
+
+    // Leitura curta ou entrada que acaba antes do fim do fluxo deflate:
+    // arquivo corrompido, não uma coluna parcial
+    return estado == Z_STREAM_END || !continuar;
+}
+
+vector<double> LeitorXLSX::lerColunaXLSX(const string& nomeArquivo, int coluna,
+                                         EstatisticasLeitura* estatisticas) {
+    TabelaColunas tabela = lerTabelaXLSX(nomeArquivo, {coluna}, estatisticas);
+    return tabela.colunas.empty() ? vector<double>() : move(tabela.colunas[0]);
+}
+
+TabelaColunas LeitorXLSX::lerTabelaXLSX(const string& nomeArquivo, const vector<int>& colunas,
+                                        EstatisticasLeitura* estatisticas) {
+    auto inicioLeitura = chrono::high_resolution_clock::now();
+    TabelaColunas tabela;
+    if (colunas.empty()) {
+        cerr << "Nenhuma coluna pedida para " << nomeArquivo << endl;
+        return tabela;
+    }
+    for (int coluna : colunas) {
+        if (coluna < 0) {
+            cerr << "Coluna inválida (" << coluna << ") para " << nomeArquivo << endl;
+            return tabela;
+        }
+    }
+    ifstream arquivo(nomeArquivo, ios::binary);
+
+    if (!arquivo.is_open()) {
+        cerr << "Erro ao abrir arquivo: " << nomeArquivo << endl;
+        return tabela;
+    }
+
+    vector<EntradaZip> entradas;
+    if (!lerDiretorioZip(arquivo, entradas)) {
+        cerr << "Arquivo não é um .xlsx (zip) válido: " << nomeArquivo << endl;
+        return tabela;
+    }
+
+    auto buscar = [&entradas](const char* nome) -> const EntradaZip* {
+        for (const EntradaZip& entrada : entradas) {
+            if (entrada.nome == nome) return &entrada;
+        }
+        return nullptr;
+    };
+
+    const EntradaZip* planilha = buscar(PLANILHA_XML);
+    if (!planilha) {
+        cerr << "Planilha " << PLANILHA_XML << " não encontrada em " << nomeArquivo << endl;
+        return tabela;
+    }
+
+    // Posição de cada coluna do arquivo na tabela de saída (-1 = ignorada)
+    int maiorColuna = *max_element(colunas.begin(), colunas.end());
+    vector<int> posicaoSaida(maiorColuna + 1, -1);
+    for (size_t k = 0; k < colunas.size(); k++) {
+        posicaoSaida[colunas[k]] = k;
+    }
+
+    const double AUSENTE = numeric_limits<double>::quiet_NaN();
+    tabela.colunas.assign(colunas.size(), vector<double>());
+    tabela.nomes.assign(colunas.size(), "");
+    vector<StringPendente> pendentes;
+
+    // Estado da passada SAX sobre sheet1.xml
+    int colunaAtual = -1;
+    int saidaAtual = -1;
+    string tipoAtual;
+    string valorAtual;
+    bool capturando = false;
+
+    auto finalizarCelula = [&]() {
+        vector<double>& destino = tabela.colunas[saidaAtual];
+        if (tipoAtual == "s") {
+            double indice;
+            if (converterNumero(valorAtual, indice)) {
+                pendentes.push_back({destino.size() - 1, static_cast<size_t>(saidaAtual),
+                                     static_cast<uint32_t>(indice)});
+            }
+        } else if (tipoAtual != "b" && tipoAtual != "e") {
+            double valor;
+            if (converterNumero(valorAtual, valor)) destino.back() = valor;
+        }
+    };
+
+    ParserXML parser;
+    parser.aoAbrir = [&](const string& nome, const string& marca, bool autoFechada) {
+        if (nome == "row") {
+            colunaAtual = -1;
+            for (vector<double>& coluna : tabela.colunas) coluna.push_back(AUSENTE);
+        } else if (nome == "c") {
+            string referencia = atributo(marca, "r");
+            colunaAtual = referencia.empty() ? colunaAtual + 1 : colunaDaReferencia(referencia);
+            saidaAtual = (colunaAtual >= 0 && colunaAtual <= maiorColuna) ? posicaoSaida[colunaAtual] : -1;
+            tipoAtual = atributo(marca, "t");
+            if (autoFechada) saidaAtual = -1;
+        } else if ((nome == "v" || nome == "t") && saidaAtual >= 0 && !autoFechada) {
+            capturando = true;
+            valorAtual.clear();
+        }
+    };
+    parser.aoFechar = [&](const string& nome) {
+        if ((nome == "v" || nome == "t") && capturando) {
+            capturando = false;
+            finalizarCelula();
+        } else if (nome == "c") {
+            saidaAtual = -1;
+        }
+    };
+    parser.aoTexto = [&](const char* texto, size_t tamanho) {
+        if (capturando) valorAtual.append(texto, tamanho);
+    };
+
+    size_t bytesPlanilha = 0;
+    if (!extrairEmFluxo(arquivo, *planilha, [&parser, &bytesPlanilha](const char* dados, size_t tamanho) {
+            parser.alimentar(dados, tamanho);
+            bytesPlanilha += tamanho;
+            return true;
+        })) {
+        cerr << "Erro ao descompactar " << PLANILHA_XML << endl;
+        tabela.colunas.clear();
+        return tabela;
+    }
+
+    // Resolução tardia das shared strings: só os índices referenciados
+    const EntradaZip* sharedStrings = buscar(SHARED_STRINGS_XML);
+    if (!pendentes.empty() && sharedStrings) {
+        sort(pendentes.begin(), pendentes.end(),
+             [](const StringPendente& a, const StringPendente& b) { return a.indice < b.indice; });
+
+        size_t proximo = 0;
+        uint32_t indiceAtual = 0;
+        bool dentroTexto = false;
+        string texto;
+
+        ParserXML parserStrings;
+        parserStrings.aoAbrir = [&](const string& nome, const string&, bool autoFechada) {
+            if (nome == "si") texto.clear();
+            else if (nome == "t" && !autoFechada) dentroTexto = true;
+        };
+        parserStrings.aoFechar = [&](const string& nome) {
+            if (nome == "t") {
+                dentroTexto = false;
+            } else if (nome == "si") {
+                for (; proximo < pendentes.size() && pendentes[proximo].indice == indiceAtual; proximo++) {
+                    const StringPendente& pendente = pendentes[proximo];
+                    double valor;
+                    if (converterNumero(texto, valor)) {
+                        tabela.colunas[pendente.coluna][pendente.linha] = valor;
+                    } else if (pendente.linha == 0) {
+                        tabela.nomes[pendente.coluna] = texto;
+                    }
+                }
+                indiceAtual++;
+            }
+        };
+        parserStrings.aoTexto = [&](const char* dados, size_t tamanho) {
+            // Só acumula texto das strings que alguma célula usa
+            if (dentroTexto && proximo < pendentes.size() && pendentes[proximo].indice == indiceAtual) {
+                texto.append(dados, tamanho);
+            }
+        };
+
+        extrairEmFluxo(arquivo, *sharedStrings, [&](const char* dados, size_t tamanho) {
+            parserStrings.alimentar(dados, tamanho);
+            return proximo < pendentes.size();
+        });
+    }
+
+    // Mantém apenas as linhas em que todas as colunas pedidas são numéricas
+    size_t numLinhas = tabela.colunas[0].size();
+    size_t validas = 0;
+    for (size_t linha = 0; linha < numLinhas; linha++) {
+        bool completa = true;
+        for (const vector<double>& coluna : tabela.colunas) {
+            completa = completa && !std::isnan(coluna[linha]);
+        }
+        if (!completa) continue;
+        for (vector<double>& coluna : tabela.colunas) {
+            coluna[validas] = coluna[linha];
+        }
+        validas++;
+    }
+    for (size_t k = 0; k < colunas.size(); k++) {
+        tabela.colunas[k].resize(validas);
+        if (tabela.nomes[k].empty()) tabela.nomes[k] = to_string(colunas[k]);
+    }
+
+    if (estatisticas) {
+        auto fimLeitura = chrono::high_resolution_clock::now();
+        estatisticas->linhas = validas;
+        estatisticas->descartadas = numLinhas - validas;
+        estatisticas->bytes = bytesPlanilha;
+        estatisticas->threads = 1;
+        estatisticas->tempoMs =
+            chrono::duration_cast<chrono::microseconds>(fimLeitura - inicioLeitura).count() / 1000.0;
+    }
+
+    cout << "Lidas " << validas << " linhas (" << colunas.size() << " colunas) da planilha "
+         << nomeArquivo << endl;
+    return tabela;
+}
+
+bool LeitorXLSX::percorrerCelulas(const string& nomeArquivo, int coluna,
+                                  const function<void(size_t, char, bool, string_view)>& visitar,
+                                  size_t& bytesPlanilha) {
+    if (coluna < 0) {
+        cerr << "Coluna inválida (" << coluna << ") para " << nomeArquivo << endl;
+        return false;
+    }
+    ifstream arquivo(nomeArquivo, ios::binary);
+
+    if (!arquivo.is_open()) {
+        cerr << "Erro ao abrir arquivo: " << nomeArquivo << endl;
+        return false;
+    }
+
+    vector<EntradaZip> entradas;
+    if (!lerDiretorioZip(arquivo, entradas)) {
+        cerr << "Arquivo não é um .xlsx (zip) válido: " << nomeArquivo << endl;
+        return false;
+    }
+
+    auto buscar = [&entradas](const char* nome) -> const EntradaZip* {
+        for (const EntradaZip& entrada : entradas) {
+            if (entrada.nome == nome) return &entrada;
+        }
+        return nullptr;
+    };
+
+    const EntradaZip* planilha = buscar(PLANILHA_XML);
+    if (!planilha) {
+        cerr << "Planilha " << PLANILHA_XML << " não encontrada em " << nomeArquivo << endl;
+        return false;
+    }
+
+    // Uma entrada por linha da planilha, na ordem: texto literal (arena
+    // temporária) ou índice de shared string, resolvido no fim. -1 marca
+    // linha sem a célula. O atributo t de cada célula fica em tiposLinha.
+    const int64_t AUSENTE = -1;
+    ColunaTexto literais;
+    vector<int64_t> origem;     // >= 0: shared string; < -1: literal -(k + 2)
+    vector<char> tiposLinha;
+
+    int colunaAtual = -1;
+    bool celulaSelecionada = false;
+    char tipoAtual = 'n';
+    string valorAtual;
+    bool capturando = false;
+
+    ParserXML parser;
+    parser.aoAbrir = [&](const string& nome, const string& marca, bool autoFechada) {
+        if (nome == "row") {
+            colunaAtual = -1;
+            origem.push_back(AUSENTE);
+            tiposLinha.push_back('n');
+        } else if (nome == "c") {
+            string referencia = atributo(marca, "r");
+            colunaAtual = referencia.empty() ? colunaAtual + 1 : colunaDaReferencia(referencia);
+            celulaSelecionada = colunaAtual == coluna && !autoFechada && !origem.empty();
+            string tipo = atributo(marca, "t");
+            if (tipo.empty()) tipoAtual = 'n';
+            else if (tipo == "inlineStr") tipoAtual = 'i';
+            else if (tipo == "str") tipoAtual = 'f';
+            else tipoAtual = tipo[0];
+            valorAtual.clear();
+        } else if ((nome == "v" || nome == "t") && celulaSelecionada && !autoFechada) {
+            // Texto inline com formatação tem vários <t>: concatena
+            capturando = true;
+        }
+    };
+    parser.aoFechar = [&](const string& nome) {
+        if ((nome == "v" || nome == "t") && capturando) {
+            capturando = false;
+        } else if (nome == "c" && celulaSelecionada) {
+            celulaSelecionada = false;
+            tiposLinha.back() = tipoAtual;
+            if (tipoAtual == 's') {
+                origem.back() = strtoll(valorAtual.c_str(), nullptr, 10);
+            } else if (!valorAtual.empty()) {
+                decodificarEntidades(valorAtual);
+                origem.back() = -static_cast<int64_t>(literais.size()) - 2;
+                literais.adicionar(valorAtual);
+            }
+        }
+    };
+    parser.aoTexto = [&](const char* texto, size_t tamanho) {
+        if (capturando) valorAtual.append(texto, tamanho);
+    };
+
+    bytesPlanilha = 0;
+    if (!extrairEmFluxo(arquivo, *planilha, [&parser, &bytesPlanilha](const char* dados, size_t tamanho) {
+            parser.alimentar(dados, tamanho);
+            bytesPlanilha += tamanho;
+            return true;
+        })) {
+        cerr << "Erro ao descompactar " << PLANILHA_XML << endl;
+        return false;
+    }
+
+    // Shared strings referenciadas pela coluna, em ordem de índice
+    vector<int64_t> indices;
+    for (int64_t indice : origem) {
+        if (indice >= 0) indices.push_back(indice);
+    }
+    sort(indices.begin(), indices.end());
+    indices.erase(unique(indices.begin(), indices.end()), indices.end());
+
+    ColunaTexto compartilhadas;
+    const EntradaZip* sharedStrings = buscar(SHARED_STRINGS_XML);
+    if (!indices.empty() && sharedStrings) {
+        size_t proximo = 0;
+        int64_t indiceAtual = 0;
+        bool dentroTexto = false;
+        string texto;
+
+        ParserXML parserStrings;
+        parserStrings.aoAbrir = [&](const string& nome, const string&, bool autoFechada) {
+            if (nome == "si") texto.clear();
+            else if (nome == "t" && !autoFechada) dentroTexto = true;
+        };
+        parserStrings.aoFechar = [&](const string& nome) {
+            if (nome == "t") {
+                dentroTexto = false;
+            } else if (nome == "si") {
+                if (proximo < indices.size() && indices[proximo] == indiceAtual) {
+                    decodificarEntidades(texto);
+                    compartilhadas.adicionar(texto);
+                    proximo++;
+                }
+                indiceAtual++;
+            }
+        };
+        parserStrings.aoTexto = [&](const char* dados, size_t tamanho) {
+            if (dentroTexto && proximo < indices.size() && indices[proximo] == indiceAtual) {
+                texto.append(dados, tamanho);
+            }
+        };
+
+        extrairEmFluxo(arquivo, *sharedStrings, [&](const char* dados, size_t tamanho) {
+            parserStrings.alimentar(dados, tamanho);
+            return proximo < indices.size();
+        });
+    }
+
+    for (size_t linha = 0; linha < origem.size(); linha++) {
+        string_view valor;
+        bool presente = false;
+        if (origem[linha] >= 0) {
+            size_t posicao = lower_bound(indices.begin(), indices.end(), origem[linha]) - indices.begin();
+            presente = posicao < compartilhadas.size();
+            if (presente) valor = compartilhadas[posicao];
+        } else if (origem[linha] < AUSENTE) {
+            presente = true;
+            valor = literais[-origem[linha] - 2];
+        }
+        visitar(linha, tiposLinha[linha], presente, valor);
+    }
+    return true;
+}
+
+ColunaTexto LeitorXLSX::lerColunaTextoXLSX(const string& nomeArquivo, int coluna,
+                                           EstatisticasLeitura* estatisticas) {
+    auto inicioLeitura = chrono::high_resolution_clock::now();
+    ColunaTexto textos;
+
+    // Monta a coluna na ordem das linhas; a primeira é o cabeçalho
+    size_t descartadas = 0;
+    size_t bytesPlanilha = 0;
+    bool lido = percorrerCelulas(nomeArquivo, coluna,
+        [&](size_t linha, char, bool presente, string_view valor) {
+            if (linha == 0) {
+                textos.nome = presente ? string(valor) : to_string(coluna);
+            } else if (presente && !valor.empty()) {
+                textos.adicionar(valor);
+            } else {
+                descartadas++;
+            }
+        }, bytesPlanilha);
+    if (!lido) return textos;
+
+    if (estatisticas) {
+        auto fimLeitura = chrono::high_resolution_clock::now();
+        estatisticas->linhas = textos.size();
+        estatisticas->descartadas = descartadas;
+        estatisticas->bytes = bytesPlanilha;
+        estatisticas->threads = 1;
+        estatisticas->tempoMs =
+            chrono::duration_cast<chrono::microseconds>(fimLeitura - inicioLeitura).count() / 1000.0;
+    }
+
+    cout << "Lidos " << textos.size() << " textos (" << textos.bytes() << " bytes) da coluna "
+         << textos.nome << " da planilha " << nomeArquivo << endl;
+    return textos;
+}
+
+ColunaCelulas LeitorXLSX::lerColunaCelulasXLSX(const string& nomeArquivo, int coluna,
+                                               EstatisticasLeitura* estatisticas) {
+    auto inicioLeitura = chrono::high_resolution_clock::now();
+    ColunaCelulas celulas;
+
+    // Tipo pelo atributo t: s, inlineStr e str são texto; e é erro; b é
+    // lógico (número 0/1); d (data ISO) fica como texto; sem t é número,
+    // e vira texto se não converter
+    size_t bytesPlanilha = 0;
+    bool lido = percorrerCelulas(nomeArquivo, coluna,
+        [&](size_t linha, char tipo, bool presente, string_view valor) {
+            if (linha == 0) {
+                celulas.nome = presente ? string(valor) : to_string(coluna);
+                return;
+            }
+            if (!presente) {
+                celulas.adicionarVazia();
+            } else if (tipo == 's' || tipo == 'i' || tipo == 'f') {
+                celulas.adicionarTexto(valor);
+            } else if (tipo == 'e') {
+                celulas.adicionarErro(valor);
+            } else {
+                double numero;
+                auto resultado = from_chars(valor.data(), valor.data() + valor.size(), numero);
+                if (tipo != 'd' && resultado.ec == errc() && resultado.ptr == valor.data() + valor.size()) {
+                    celulas.adicionarNumero(numero);
+                } else {
+                    celulas.adicionarTexto(valor);
+                }
+            }
+        }, bytesPlanilha);
+    if (!lido) return celulas;
+
+    if (estatisticas) {
+        auto fimLeitura = chrono::high_resolution_clock::now();
+        estatisticas->linhas = celulas.size();
+        estatisticas->descartadas = 0;
+        estatisticas->bytes = bytesPlanilha;
+        estatisticas->threads = 1;
+        estatisticas->tempoMs =
+            chrono::duration_cast<chrono::microseconds>(fimLeitura - inicioLeitura).count() / 1000.0;
+    }
+
+    cout << "Lidas " << celulas.size() << " células da coluna " << celulas.nome << " da planilha "
+         << nomeArquivo << " (" << celulas.contar(TipoCelula::Numero) << " números, "
+         << celulas.contar(TipoCelula::Texto) << " textos, " << celulas.contar(TipoCelula::Erro)
+         << " erros, " << celulas.contar(TipoCelula::Vazia) << " vazias)" << endl;
+    return celulas;
+}
@@ -0,0 +1,72 @@
+#ifndef LEITOR_XLSX_H
+#define LEITOR_XLSX_H
+
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "tabela_colunas.h"
+#include "csv_reader.h"
+#include "coluna_texto.h"
+#include "coluna_celulas.h"
+
+using namespace std;
+
+// Leitor nativo de .xlsx: descompacta xl/worksheets/sheet1.xml em fluxo
+// (zlib) e percorre o XML como SAX, guardando apenas as colunas pedidas.
+// As shared strings só são lidas se alguma célula selecionada apontar para
+// elas, e só os índices necessários são convertidos.
+class LeitorXLSX {
+public:
+    // Coluna numérica (índice a partir de 0, como em converter_excel.py).
+    // Células vazias ou não numéricas são descartadas.
+    static vector<double> lerColunaXLSX(const string& nomeArquivo, int coluna,
+                                        EstatisticasLeitura* estatisticas = nullptr);
+
+    // Várias colunas; mantém apenas as linhas em que todas são numéricas.
+    // Em estatisticas, bytes é o tamanho descompactado de sheet1.xml.
+    static TabelaColunas lerTabelaXLSX(const string& nomeArquivo, const vector<int>& colunas,
+                                       EstatisticasLeitura* estatisticas = nullptr);
+
+    // Coluna de texto: shared strings, strings inline e fórmulas de texto;
+    // números entram como o texto gravado na célula. A primeira linha é o
+    // nome da coluna; células vazias ou ausentes são descartadas.
+    static ColunaTexto lerColunaTextoXLSX(const string& nomeArquivo, int coluna,
+                                          EstatisticasLeitura* estatisticas = nullptr);
+
+    // Coluna com tipos misturados, todas as linhas mantidas (ausentes
+    // viram vazias): texto, número, lógico (0/1) e erro pelo atributo t
+    static ColunaCelulas lerColunaCelulasXLSX(const string& nomeArquivo, int coluna,
+                                              EstatisticasLeitura* estatisticas = nullptr);
+
+private:
+    struct EntradaZip {
+        string nome;
+        uint16_t metodo;
+        uint32_t tamanhoCompactado;
+        uint32_t tamanhoOriginal;
+        uint32_t deslocamentoCabecalho;
+    };
+
+    // Lê o diretório central do arquivo zip
+    static bool lerDiretorioZip(ifstream& arquivo, vector<EntradaZip>& entradas);
+
+    // Entrega o conteúdo descompactado em blocos ao consumidor, que pode
+    // interromper a leitura retornando false
+    static bool extrairEmFluxo(ifstream& arquivo, const EntradaZip& entrada,
+                               const function<bool(const char*, size_t)>& consumidor);
+
+    // Percorre a coluna linha a linha (incluindo a do cabeçalho) com as
+    // shared strings já resolvidas: visitar(linha, t, presente, valor),
+    // onde t é 's', 'i' (inlineStr), 'f' (str, fórmula de texto), 'n'
+    // (sem atributo) ou a inicial dos demais (b, e, d)
+    static bool percorrerCelulas(const string& nomeArquivo, int coluna,
+                                 const function<void(size_t, char, bool, string_view)>& visitar,
+                                 size_t& bytesPlanilha);
+
+    static int colunaDaReferencia(const string& referencia);
+};
+
+#endif
@@ -1,19 +1,33 @@
+#include <cctype>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
 #include <fstream>
 #include <iostream>
 #include <string>
 #include <vector>
 
 #include "algoritmos_ordenacao.h"
+#include "ambiente_execucao.h"
 #include "benchmark.h"
 #include "csv_reader.h"
+#include "leitor_xlsx.h"
+#include "cache_colunar.h"
+#include "ordenacao_externa.h"
+#include "gerador_distribuicoes.h"
+#include "despacho_ordenacao.h"
 
 using namespace std;
 
 // Configurações para a planilha oficial
 const string PLANILHA_OFICIAL =
     "../dados/Relatorio_Geral_Inventario_2024_Dump.xlsx";
+const vector<string> CAMINHOS_PLANILHA = {
+    "dados/Relatorio_Geral_Inventario_2024_Dump.xlsx", PLANILHA_OFICIAL};
 const string CSV_OFICIAL =
     "../dados/dados_reais_Relatorio_Geral_Inventario_2024_Dump.csv";
+const string CSV_MULTICHAVE =
+    "../dados/dados_multichave_Relatorio_Geral_Inventario_2024_Dump.csv";
 
 // Colunas disponíveis (baseado na análise)
 struct ColunaInfo {
@@ -47,67 +61,163 @@ void mostrarColunas() {
   cout << "Escolha uma opção (1-" << NUM_COLUNAS << "): ";
 }
 
-void executarBenchmarkOficial(int opcaoColuna) {
-  if (opcaoColuna < 1 || opcaoColuna > NUM_COLUNAS) {
-    cout << "Opção inválida!" << endl;
+// Ordenação estilo Calc: CÓD. CENTRO DE CUSTO crescente, depois CÓDIGO
+// decrescente. As duas colunas vêm direto da planilha (leitor nativo) ou,
+// na falta dela, do CSV multichave exportado por converter_excel.py.
+void executarBenchmarkMultiChaveOficial(vector<ResultadoBenchmark>& resultados) {
+  TabelaColunas tabela;
+  for (const string& caminho : CAMINHOS_PLANILHA) {
+    if (!ifstream(caminho).good()) continue;
+    tabela = LeitorXLSX::lerTabelaXLSX(caminho, {11, 1});
+    if (tabela.numLinhas() > 0) break;
+  }
+
+  vector<string> caminhosPossiveis = {
+      CSV_MULTICHAVE,
+      "dados/dados_multichave_Relatorio_Geral_Inventario_2024_Dump.csv"};
+
+  for (const string& caminho : caminhosPossiveis) {
+    if (tabela.numLinhas() > 0) break;
+    tabela = CSVReader::lerTabelaCSV(caminho, {0, 1});
+  }
+
+  if (tabela.numLinhas() == 0) {
+    cout << "Erro: Não foi possível carregar dados multichave!" << endl;
     return;
   }
 
-  ColunaInfo coluna = COLUNAS_NUMERICAS[opcaoColuna - 1];
+  Benchmark::executarBenchmarkMultiChave(tabela, {{0, true}, {1, false}},
+                                         resultados);
 
-  cout << "\n=== CONFIGURAÇÃO DO BENCHMARK OFICIAL ===" << endl;
-  cout << "Coluna selecionada: " << coluna.nome << endl;
-  cout << "Descrição: " << coluna.descricao << endl;
+  // Mesmas linhas ordenadas só pelo centro de custo, agora movendo 20
+  // colunas de carga junto com a chave
+  Benchmark::executarBenchmarkPermutacao(tabela, 0, resultados);
+}
 
-  // Verificar se CSV já existe
-  ifstream teste(CSV_OFICIAL);
-  if (!teste.good()) {
-    cout << "\nConvertendo planilha Excel para CSV..." << endl;
-    string comando = "cd codigo && python3 converter_excel.py " +
-                     PLANILHA_OFICIAL + " --coluna " + to_string(coluna.indice);
-    int resultado = system(comando.c_str());
-
-    if (resultado != 0) {
-      cout << "Erro na conversão! Execute manualmente:" << endl;
-      cout << comando << endl;
-      return;
+// Carrega a coluna pelo cache binário (.colbin) quando ele corresponde ao
+// conteúdo atual da origem; senão lê o CSV (ou a planilha, se não houver
+// CSV) e cria o cache para as próximas execuções
+ColunaMapeada carregarColunaOficial(const ColunaInfo& coluna,
+                                    EstatisticasLeitura& leitura) {
+  vector<string> caminhosCSV = {
+      CSV_OFICIAL, "dados/dados_reais_Relatorio_Geral_Inventario_2024_Dump.csv"};
+
+  string origem;
+  bool origemCSV = false;
+  for (const string& caminho : caminhosCSV) {
+    if (ifstream(caminho).good()) {
+      origem = caminho;
+      origemCSV = true;
+      break;
     }
   }
+  for (const string& caminho : CAMINHOS_PLANILHA) {
+    if (!origem.empty()) break;
+    if (ifstream(caminho).good()) origem = caminho;
+  }
+  if (origem.empty()) return ColunaMapeada();
 
-  // Carregar dados
-  cout << "\nCarregando dados oficiais..." << endl;
+  cout << "Arquivo encontrado: " << origem << endl;
 
-  // Tentar diferentes caminhos
-  vector<string> caminhosPossiveis = {
-      CSV_OFICIAL, "dados/dados_reais_Relatorio_Geral_Inventario_2024_Dump.csv",
-      "../dados/dados_reais_Relatorio_Geral_Inventario_2024_Dump.csv"};
+  // No CSV convertido os valores estão na coluna "Valor"
+  int indiceOrigem = origemCSV ? 1 : coluna.indice;
+  string caminhoCache = CacheColunar::caminhoCache(origem, indiceOrigem);
+
+  auto inicio = high_resolution_clock::now();
+  uint64_t hash;
+  if (!CacheColunar::hashArquivo(origem, hash)) {
+    // Sem hash não há como saber se algum cache corresponde à origem
+    cout << "Erro: Não foi possível calcular o hash de " << origem << endl;
+    return ColunaMapeada();
+  }
+  ColunaMapeada mapeada = CacheColunar::abrir(caminhoCache, hash, indiceOrigem);
+
+  if (mapeada.valida()) {
+    auto fim = high_resolution_clock::now();
+    leitura.linhas = mapeada.size();
+    leitura.bytes = mapeada.size() * sizeof(double);
+    leitura.threads = 1;
+    leitura.tempoMs = duration_cast<microseconds>(fim - inicio).count() / 1000.0;
+    cout << "Cache binário válido: " << caminhoCache << endl;
+    return mapeada;
+  }
 
   vector<double> dados;
-  string arquivoEncontrado = "";
+  if (origemCSV) {
+    dados = CSVReader::lerArquivoCSVMapeado(origem, 1, 0, &leitura);
+  } else {
+    cout << "CSV não encontrado, lendo a planilha Excel (leitor nativo)..."
+         << endl;
+    dados = LeitorXLSX::lerColunaXLSX(origem, coluna.indice, &leitura);
+  }
+  if (dados.empty()) return ColunaMapeada();
 
-  for (const string& caminho : caminhosPossiveis) {
-    dados = CSVReader::lerArquivoCSV(caminho, 1);  // Coluna "Valor" no CSV
-    if (!dados.empty()) {
-      arquivoEncontrado = caminho;
-      cout << "Arquivo encontrado: " << caminho << endl;
-      break;
-    }
+  if (!CacheColunar::gravar(caminhoCache, dados, hash, indiceOrigem)) {
+    return ColunaMapeada();
+  }
+  cout << "Cache binário criado: " << caminhoCache << endl;
+  return CacheColunar::abrir(caminhoCache, hash, indiceOrigem);
+}
+
+// Resultados em CSV e, ao lado, o mesmo conteúdo em JSON
+void salvarResultadosOficiais(const vector<ResultadoBenchmark>& resultados,
+                              const string& arquivoCSV) {
+  Benchmark::salvarResultados(resultados, arquivoCSV);
+  string arquivoJSON = arquivoCSV.substr(0, arquivoCSV.rfind('.')) + ".json";
+  Benchmark::salvarResultadosJSON(resultados, arquivoJSON);
+}
+
+// Compara dois CSVs de resultados; 0 sem regressões, 2 com regressões
+// significativas e 1 se algum arquivo não puder ser lido
+int compararArquivos(const string& linhaBase, const string& atual,
+                     double toleranciaPercentual) {
+  vector<ResultadoBenchmark> base, novos;
+  vector<pair<string, string>> ambienteBase, ambienteAtual;
+  if (!Benchmark::carregarResultados(linhaBase, base, ambienteBase) ||
+      !Benchmark::carregarResultados(atual, novos, ambienteAtual)) {
+    return 1;
   }
 
-  if (dados.empty()) {
+  cout << "\nLinha de base: " << linhaBase << endl;
+  cout << "Atual: " << atual << endl;
+  int regressoes = Benchmark::compararComLinhaBase(
+      base, ambienteBase, novos, ambienteAtual, toleranciaPercentual / 100);
+  return regressoes > 0 ? 2 : 0;
+}
+
+// Devolve o CSV gravado (vazio se não houve execução)
+string executarBenchmarkOficial(int opcaoColuna) {
+  if (opcaoColuna < 1 || opcaoColuna > NUM_COLUNAS) {
+    cout << "Opção inválida!" << endl;
+    return "";
+  }
+
+  ColunaInfo coluna = COLUNAS_NUMERICAS[opcaoColuna - 1];
+
+  cout << "\n=== CONFIGURAÇÃO DO BENCHMARK OFICIAL ===" << endl;
+  cout << "Coluna selecionada: " << coluna.nome << endl;
+  cout << "Descrição: " << coluna.descricao << endl;
+
+  cout << "\nCarregando dados oficiais..." << endl;
+
+  EstatisticasLeitura leitura;
+  ColunaMapeada dados = carregarColunaOficial(coluna, leitura);
+
+  if (!dados.valida() || dados.empty()) {
     cout << "Erro: Não foi possível carregar dados!" << endl;
-    return;
+    return "";
   }
 
   cout << "Dados carregados: " << dados.size() << " registros" << endl;
+  cout << "Tempo de carga: " << leitura.tempoMs << " ms ("
+       << leitura.linhasPorSegundo() << " linhas/s, " << leitura.mbPorSegundo()
+       << " MB/s)" << endl;
 
-  // Análise dos dados
+  // Análise dos dados (estatísticas gravadas no cabeçalho do cache)
   cout << "\n=== ANÁLISE DOS DADOS OFICIAIS ===" << endl;
-  double minimo = *min_element(dados.begin(), dados.end());
-  double maximo = *max_element(dados.begin(), dados.end());
-  double soma = 0;
-  for (double valor : dados) soma += valor;
-  double media = soma / dados.size();
+  double minimo = dados.cabecalho().minimo;
+  double maximo = dados.cabecalho().maximo;
+  double media = dados.cabecalho().media;
 
   cout << "Coluna: " << coluna.nome << endl;
   cout << "Registros: " << dados.size() << endl;
@@ -137,12 +247,24 @@ void executarBenchmarkOficial(int opcaoColuna) {
     }
   }
 
+  executarBenchmarkMultiChaveOficial(todosResultados);
+
+  // Edição de 100 linhas numa coluna já ordenada
+  Benchmark::executarBenchmarkIncremental(
+      vector<double>(dados.begin(), dados.end()), 100, todosResultados);
+
+  // Custo da seleção dos k menores em função de k
+  size_t n = dados.size();
+  Benchmark::executarBenchmarkTopK(vector<double>(dados.begin(), dados.end()),
+                                   {1, 10, 100, 1000, n / 100, n / 10, n / 2},
+                                   todosResultados);
+
   // Salvar resultados oficiais
   cout << "\n=== SALVANDO RESULTADOS OFICIAIS ===" << endl;
   Benchmark::imprimirResultados(todosResultados);
 
   string arquivoResultados = "dados/resultados_artigo_oficial.csv";
-  Benchmark::salvarResultados(todosResultados, arquivoResultados);
+  salvarResultadosOficiais(todosResultados, arquivoResultados);
 
   // Criar metadados
   ofstream meta("dados/metadados_benchmark_oficial.txt");
@@ -156,13 +278,28 @@ void executarBenchmarkOficial(int opcaoColuna) {
   meta << "Valor mínimo: " << minimo << "\n";
   meta << "Valor máximo: " << maximo << "\n";
   meta << "Valor médio: " << media << "\n";
+  meta << "Carga dos dados: " << leitura.tempoMs << " ms, " << leitura.threads
+       << " threads, " << leitura.linhasPorSegundo() << " linhas/s, "
+       << leitura.mbPorSegundo() << " MB/s\n";
+  const ConfiguracaoMedicao& medicao = Benchmark::configuracaoMedicao();
+  meta << "Medição: " << medicao.aquecimento << " aquecimento(s), "
+       << medicao.repeticoes << " repetições, tempo = mediana, IC "
+       << medicao.nivelConfianca * 100 << "% por bootstrap ("
+       << medicao.reamostragensBootstrap << " reamostragens), outliers "
+       << (medicao.removerOutliers ? "removidos (1.5 x IQR)" : "mantidos")
+       << ", CPU "
+       << (medicao.cpuFixa >= 0 ? to_string(medicao.cpuFixa) : "livre")
+       << "\n";
   meta << "Tamanhos testados: ";
   for (size_t i = 0; i < tamanhos.size(); i++) {
     meta << tamanhos[i];
     if (i < tamanhos.size() - 1) meta << ", ";
   }
   meta << "\n";
-  meta << "Data/Hora: " << __DATE__ << " às " << __TIME__ << "\n";
+  meta << "\nAmbiente:\n";
+  for (const auto& campo : AmbienteExecucao::capturar().campos()) {
+    meta << "  " << campo.first << ": " << campo.second << "\n";
+  }
   meta.close();
 
   cout << "\n=== ARQUIVOS GERADOS ===" << endl;
@@ -174,19 +311,402 @@ void executarBenchmarkOficial(int opcaoColuna) {
 
   cout << "\n🎯 BENCHMARK OFICIAL CONCLUÍDO!" << endl;
   cout << "Os resultados estão prontos para o artigo científico." << endl;
+  return arquivoResultados;
 }
 
-int main() {
-  cout << "=== BENCHMARK OFICIAL PARA ARTIGO CIENTÍFICO ===" << endl;
-  cout << "Planilha: Relatorio_Geral_Inventario_2024_Dump.xlsx" << endl;
-  cout << "Registros: 94.011 linhas de dados reais de inventário" << endl;
+// Ordenação externa: grava 'fator' cópias da coluna em um arquivo bruto e o
+// ordena com no máximo 'memoriaMB' de memória, simulando uma entrada maior
+// que a RAM disponível
+string executarBenchmarkExternoOficial(int opcaoColuna, size_t memoriaMB,
+                                       size_t fator) {
+  if (opcaoColuna < 1 || opcaoColuna > NUM_COLUNAS) {
+    cout << "Opção inválida!" << endl;
+    return "";
+  }
 
-  mostrarColunas();
+  ColunaInfo coluna = COLUNAS_NUMERICAS[opcaoColuna - 1];
+  cout << "\nCarregando dados oficiais..." << endl;
 
-  int opcao;
-  cin >> opcao;
+  EstatisticasLeitura leitura;
+  ColunaMapeada dados = carregarColunaOficial(coluna, leitura);
+  if (!dados.valida() || dados.empty()) {
+    cout << "Erro: Não foi possível carregar dados!" << endl;
+    return "";
+  }
+
+  string arquivoBruto = "dados/externo_" + to_string(coluna.indice) + ".bin";
+  cout << "Gravando " << fator << " cópias de " << dados.size()
+       << " registros em " << arquivoBruto << endl;
+  if (!OrdenacaoExterna::gravarArquivoBruto(arquivoBruto, dados.data(),
+                                            dados.size(), fator)) {
+    return "";
+  }
+
+  vector<ResultadoBenchmark> resultados;
+  Benchmark::executarBenchmarkExterno(arquivoBruto, memoriaMB * 1024 * 1024,
+                                      resultados);
+  remove(arquivoBruto.c_str());
+
+  Benchmark::imprimirResultados(resultados);
+  salvarResultadosOficiais(resultados, "dados/resultados_externo.csv");
+  return "dados/resultados_externo.csv";
+}
 
-  executarBenchmarkOficial(opcao);
+// Coluna de texto da planilha (ou de um CSV, pela extensão) ordenada em
+// ordem de bytes e pelos níveis de colação
+string executarBenchmarkTextoOficial(int indiceColuna, const string& arquivo) {
+  ColunaTexto coluna;
+  bool csv = arquivo.size() > 4 && arquivo.substr(arquivo.size() - 4) == ".csv";
+  if (csv) {
+    coluna = CSVReader::lerColunaTextoCSV(arquivo, indiceColuna);
+  } else {
+    vector<string> caminhos = CAMINHOS_PLANILHA;
+    if (!arquivo.empty()) caminhos.insert(caminhos.begin(), arquivo);
+    for (const string& caminho : caminhos) {
+      if (!ifstream(caminho).good()) continue;
+      coluna = LeitorXLSX::lerColunaTextoXLSX(caminho, indiceColuna);
+      if (!coluna.empty()) break;
+    }
+  }
+
+  if (coluna.empty()) {
+    cout << "Erro: Não foi possível carregar a coluna de texto "
+         << indiceColuna << "!" << endl;
+    return "";
+  }
+
+  vector<ResultadoBenchmark> resultados;
+  Benchmark::executarBenchmarkTexto(coluna, {1000, 10000, 100000, coluna.size()},
+                                    resultados);
+  Benchmark::imprimirResultados(resultados);
+  salvarResultadosOficiais(resultados, "dados/resultados_texto.csv");
+  return "dados/resultados_texto.csv";
+}
+
+// Coluna mista da planilha (ou de um CSV) na ordem do Calc: partição por
+// tipo contra o comparador genérico
+string executarBenchmarkCelulasOficial(int indiceColuna, const string& arquivo) {
+  ColunaCelulas coluna;
+  bool csv = arquivo.size() > 4 && arquivo.substr(arquivo.size() - 4) == ".csv";
+  if (csv) {
+    coluna = CSVReader::lerColunaCelulasCSV(arquivo, indiceColuna);
+  } else {
+    vector<string> caminhos = CAMINHOS_PLANILHA;
+    if (!arquivo.empty()) caminhos.insert(caminhos.begin(), arquivo);
+    for (const string& caminho : caminhos) {
+      if (!ifstream(caminho).good()) continue;
+      coluna = LeitorXLSX::lerColunaCelulasXLSX(caminho, indiceColuna);
+      if (!coluna.empty()) break;
+    }
+  }
+
+  if (coluna.empty()) {
+    cout << "Erro: Não foi possível carregar a coluna " << indiceColuna
+         << "!" << endl;
+    return "";
+  }
+
+  vector<ResultadoBenchmark> resultados;
+  Benchmark::executarBenchmarkCelulas(coluna, {1000, 10000, 100000, coluna.size()},
+                                      resultados);
+  Benchmark::imprimirResultados(resultados);
+  salvarResultadosOficiais(resultados, "dados/resultados_celulas.csv");
+  return "dados/resultados_celulas.csv";
+}
+
+vector<string> dividirLista(const string& lista) {
+  vector<string> itens;
+  size_t inicio = 0;
+  while (inicio <= lista.size()) {
+    size_t fim = lista.find(',', inicio);
+    if (fim == string::npos) fim = lista.size();
+    if (fim > inicio) itens.push_back(lista.substr(inicio, fim - inicio));
+    inicio = fim + 1;
+  }
+  return itens;
+}
+
+// Varredura algoritmo x distribuição x tamanho com entradas sintéticas
+string executarVarreduraOficial(const vector<string>& nomesDistribuicoes,
+                                const vector<size_t>& tamanhos,
+                                const vector<string>& algoritmos,
+                                uint64_t semente, double orcamentoMs) {
+  vector<Distribuicao> distribuicoes;
+  for (const string& nome : nomesDistribuicoes) {
+    Distribuicao tipo;
+    if (!GeradorDistribuicoes::porNome(nome, tipo)) {
+      cout << "Distribuição desconhecida: " << nome << endl;
+      return "";
+    }
+    distribuicoes.push_back(tipo);
+  }
+  if (distribuicoes.empty()) distribuicoes = GeradorDistribuicoes::todas();
+
+  cout << "\n=== VARREDURA DE DISTRIBUIÇÕES (semente " << semente << ") ==="
+       << endl;
+  if (orcamentoMs > 0) {
+    cout << "Orçamento por ordenação: " << orcamentoMs << " ms" << endl;
+  }
+
+  vector<ResultadoBenchmark> resultados;
+  Benchmark::executarVarreduraDistribuicoes(distribuicoes, tamanhos, algoritmos,
+                                            semente, resultados, orcamentoMs);
+  salvarResultadosOficiais(resultados, "dados/resultados_distribuicoes.csv");
+  return "dados/resultados_distribuicoes.csv";
+}
+
+// Autoajuste do despacho de ordenação nesta máquina: grava o arquivo de
+// ajuste e passa a usá-lo no restante da execução
+string executarAutoajusteOficial(const vector<string>& nomesDistribuicoes,
+                                 const vector<size_t>& tamanhos, uint64_t semente,
+                                 const string& arquivoAjuste) {
+  vector<Distribuicao> distribuicoes;
+  for (const string& nome : nomesDistribuicoes) {
+    Distribuicao tipo;
+    if (!GeradorDistribuicoes::porNome(nome, tipo)) {
+      cout << "Distribuição desconhecida: " << nome << endl;
+      return "";
+    }
+    distribuicoes.push_back(tipo);
+  }
+  if (distribuicoes.empty()) {
+    distribuicoes = {Distribuicao::Aleatoria, Distribuicao::QuaseOrdenada,
+                     Distribuicao::PoucosValores, Distribuicao::Zipf};
+  }
+
+  vector<ResultadoBenchmark> resultados;
+  ConfiguracaoDespacho ajuste =
+      Benchmark::executarAutoajuste(distribuicoes, tamanhos, semente, resultados);
+  if (!DespachoOrdenacao::salvar(arquivoAjuste, ajuste) ||
+      !DespachoOrdenacao::inicializar(arquivoAjuste)) {
+    return "";
+  }
+  cout << "✓ Ajuste: " << arquivoAjuste << endl;
+
+  salvarResultadosOficiais(resultados, "dados/resultados_autoajuste.csv");
+  return "dados/resultados_autoajuste.csv";
+}
+
+// Progressão geométrica "inicio,fim,fator": inicio, inicio*fator, ... <= fim
+vector<size_t> progressaoGeometrica(const string& especificacao) {
+  vector<string> partes = dividirLista(especificacao);
+  vector<size_t> tamanhos;
+  if (partes.size() != 3) return tamanhos;
+
+  double atual = strtod(partes[0].c_str(), nullptr);
+  double fim = strtod(partes[1].c_str(), nullptr);
+  double fator = strtod(partes[2].c_str(), nullptr);
+  if (atual < 1 || fator <= 1) return tamanhos;
+
+  for (; atual <= fim * (1 + 1e-9); atual *= fator) {
+    size_t tamanho = static_cast<size_t>(llround(atual));
+    if (tamanhos.empty() || tamanho != tamanhos.back()) tamanhos.push_back(tamanho);
+  }
+  return tamanhos;
+}
+
+// Gera uma entrada sintética em fluxo: .csv no formato de
+// criarArquivoTeste, qualquer outra extensão em binário bruto
+int gerarEntradaSintetica(const string& nomeDistribuicao, uint64_t n,
+                          const string& arquivo, uint64_t semente) {
+  ParametrosDistribuicao parametros;
+  parametros.semente = semente;
+  if (!GeradorDistribuicoes::porNome(nomeDistribuicao, parametros.tipo)) {
+    cerr << "Distribuição desconhecida: " << nomeDistribuicao << endl;
+    return 1;
+  }
+
+  bool csv = arquivo.size() > 4 && arquivo.substr(arquivo.size() - 4) == ".csv";
+  bool ok = csv ? CSVReader::criarArquivoTeste(arquivo, n, parametros)
+                : GeradorDistribuicoes::gravarArquivoBruto(parametros, n, arquivo);
+  if (ok && !csv) {
+    cout << "Gerados " << n << " valores (" << nomeDistribuicao << ") em "
+         << arquivo << endl;
+  }
+  return ok ? 0 : 1;
+}
+
+int main(int argc, char** argv) {
+  // Uso: benchmark_oficial_simples [--externo [memoriaMB] [fator]]
+  //          [--repeticoes N] [--aquecimento N] [--cpu K] [--sem-outliers]
+  //          [--sem-contadores]
+  //          [--coluna K] (sem ela a coluna é lida da entrada padrão)
+  //        benchmark_oficial_simples --varredura [--distribuicoes a,b,...]
+  //          [--tamanhos n1,n2,... | --progressao inicio,fim,fator]
+  //          [--algoritmos "A,B,..."] [--semente S] [--orcamento ms]
+  //        benchmark_oficial_simples --gerar <distribuicao> <n> <arquivo>
+  //        benchmark_oficial_simples --texto [coluna] [arquivo.xlsx|.csv]
+  //          (coluna a partir de 0; padrão 2, arquivo padrão a planilha)
+  //        benchmark_oficial_simples --celulas [coluna] [arquivo.xlsx|.csv]
+  //          (coluna com números, textos, erros e vazias na ordem do Calc)
+  //        benchmark_oficial_simples --autoajuste [arquivo]
+  //          [--distribuicoes a,b,...] [--tamanhos n1,n2,...] [--semente S]
+  //          (mede limiares e algoritmo por tamanho; grava
+  //          o ajuste, padrão dados/ajuste_ordenacao.txt)
+  //        Em todos os modos, --ajuste <arquivo> troca o arquivo de ajuste
+  //        lido na inicialização.
+  //        benchmark_oficial_simples --comparar <linha_base.csv> <atual.csv>
+  //          [--tolerancia pct]
+  //        Nos modos de execução, --linha-base <arquivo.csv> compara o
+  //        resultado gravado com ela; sai com 2 se algum tempo regredir.
+  bool modoExterno = false;
+  bool modoVarredura = false;
+  bool modoTexto = false;
+  bool modoCelulas = false;
+  bool modoAutoajuste = false;
+  string arquivoAjuste = DespachoOrdenacao::ARQUIVO_PADRAO;
+  int colunaTexto = 2;
+  string arquivoTexto;
+  size_t memoriaMB = 64;
+  size_t fator = 100;
+  ConfiguracaoMedicao medicao;
+  string distribuicoes, algoritmos, tamanhosTexto = "1000,10000,100000";
+  string progressao;
+  uint64_t semente = 42;
+  size_t orcamentoMs = 0;
+  int coluna = -1;
+  vector<string> geracao;
+  vector<string> comparacao;
+  string linhaBase;
+  double toleranciaPercentual = 5;
+
+  // Consome o próximo argumento se ele for um número
+  int i = 1;
+  auto proximoNumero = [&](auto& destino) {
+    if (i + 1 < argc && isdigit(static_cast<unsigned char>(argv[i + 1][0]))) {
+      destino = strtoul(argv[++i], nullptr, 10);
+    }
+  };
+
+  // Consome o próximo argumento se ele não for outra opção
+  auto proximoTexto = [&](string& destino) {
+    if (i + 1 < argc && string(argv[i + 1]).rfind("--", 0) != 0) {
+      destino = argv[++i];
+    }
+  };
+
+  for (; i < argc; i++) {
+    string argumento = argv[i];
+    if (argumento == "--varredura") {
+      modoVarredura = true;
+    } else if (argumento == "--distribuicoes") {
+      proximoTexto(distribuicoes);
+    } else if (argumento == "--tamanhos") {
+      proximoTexto(tamanhosTexto);
+    } else if (argumento == "--progressao") {
+      proximoTexto(progressao);
+    } else if (argumento == "--orcamento") {
+      proximoNumero(orcamentoMs);
+    } else if (argumento == "--coluna") {
+      proximoNumero(coluna);
+    } else if (argumento == "--algoritmos") {
+      proximoTexto(algoritmos);
+    } else if (argumento == "--semente") {
+      proximoNumero(semente);
+    } else if (argumento == "--comparar" && i + 2 < argc) {
+      comparacao.assign(argv + i + 1, argv + i + 3);
+      i += 2;
+    } else if (argumento == "--linha-base") {
+      proximoTexto(linhaBase);
+    } else if (argumento == "--tolerancia" && i + 1 < argc) {
+      toleranciaPercentual = strtod(argv[++i], nullptr);
+    } else if (argumento == "--gerar" && i + 3 < argc) {
+      geracao.assign(argv + i + 1, argv + i + 4);
+      i += 3;
+    } else if (argumento == "--texto" || argumento == "--celulas") {
+      (argumento == "--texto" ? modoTexto : modoCelulas) = true;
+      proximoNumero(colunaTexto);
+      proximoTexto(arquivoTexto);
+    } else if (argumento == "--autoajuste") {
+      modoAutoajuste = true;
+      proximoTexto(arquivoAjuste);
+    } else if (argumento == "--ajuste") {
+      proximoTexto(arquivoAjuste);
+    } else if (argumento == "--externo") {
+      modoExterno = true;
+      proximoNumero(memoriaMB);
+      proximoNumero(fator);
+    } else if (argumento == "--repeticoes") {
+      proximoNumero(medicao.repeticoes);
+    } else if (argumento == "--aquecimento") {
+      proximoNumero(medicao.aquecimento);
+    } else if (argumento == "--cpu") {
+      proximoNumero(medicao.cpuFixa);
+    } else if (argumento == "--sem-outliers") {
+      medicao.removerOutliers = false;
+    } else if (argumento == "--sem-contadores") {
+      medicao.contadoresHardware = false;
+    } else {
+      cerr << "Argumento desconhecido: " << argumento << endl;
+      return 1;
+    }
+  }
+  Benchmark::configurarMedicao(medicao);
+
+  if (!modoAutoajuste && !DespachoOrdenacao::inicializar(arquivoAjuste)) {
+    cerr << "Arquivo de ajuste inválido, usando os padrões: " << arquivoAjuste
+         << endl;
+  }
+
+  if (!geracao.empty()) {
+    return gerarEntradaSintetica(geracao[0], strtoull(geracao[1].c_str(), nullptr, 10),
+                                 geracao[2], semente);
+  }
+
+  if (!comparacao.empty()) {
+    return compararArquivos(comparacao[0], comparacao[1], toleranciaPercentual);
+  }
+
+  cout << "Despacho: " << DespachoOrdenacao::descricao() << endl;
+
+  string gerado;
+  if (modoAutoajuste) {
+    vector<size_t> tamanhos;
+    for (const string& tamanho : dividirLista(tamanhosTexto)) {
+      tamanhos.push_back(strtoul(tamanho.c_str(), nullptr, 10));
+    }
+    gerado = executarAutoajusteOficial(dividirLista(distribuicoes), tamanhos,
+                                       semente, arquivoAjuste);
+  } else if (modoTexto) {
+    gerado = executarBenchmarkTextoOficial(colunaTexto, arquivoTexto);
+  } else if (modoCelulas) {
+    gerado = executarBenchmarkCelulasOficial(colunaTexto, arquivoTexto);
+  } else if (modoVarredura) {
+    vector<size_t> tamanhos;
+    if (!progressao.empty()) {
+      tamanhos = progressaoGeometrica(progressao);
+      if (tamanhos.empty()) {
+        cerr << "Progressão inválida (use inicio,fim,fator com fator > 1): "
+             << progressao << endl;
+        return 1;
+      }
+    } else {
+      for (const string& tamanho : dividirLista(tamanhosTexto)) {
+        tamanhos.push_back(strtoul(tamanho.c_str(), nullptr, 10));
+      }
+    }
+    gerado = executarVarreduraOficial(dividirLista(distribuicoes), tamanhos,
+                                      dividirLista(algoritmos), semente,
+                                      orcamentoMs);
+  } else {
+    cout << "=== BENCHMARK OFICIAL PARA ARTIGO CIENTÍFICO ===" << endl;
+    cout << "Planilha: Relatorio_Geral_Inventario_2024_Dump.xlsx" << endl;
+    cout << "Registros: 94.011 linhas de dados reais de inventário" << endl;
+
+    int opcao = coluna;
+    if (opcao < 0) {
+      mostrarColunas();
+      cin >> opcao;
+    }
+
+    if (modoExterno) {
+      gerado = executarBenchmarkExternoOficial(opcao, memoriaMB, fator);
+    } else {
+      gerado = executarBenchmarkOficial(opcao);
+    }
+  }
 
-  return 0;
+  if (linhaBase.empty()) return 0;
+  if (gerado.empty()) return 1;
+  return compararArquivos(linhaBase, gerado, toleranciaPercentual);
 }
\ No newline at end of file
@@ -0,0 +1,319 @@
+#ifndef ORDENACAO_ADAPTATIVA_H
+#define ORDENACAO_ADAPTATIVA_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+// Ordenação estável adaptativa (header-only): aproveita as sequências já
+// ordenadas da entrada. Custa O(n) numa coluna ordenada e O(n + k log k)
+// para reinserir k valores novos ou alterados numa coluna já ordenada.
+namespace ordenacao {
+
+namespace detalhe_adaptativa {
+
+// Runs naturais menores que isto são estendidos por inserção binária
+constexpr ptrdiff_t RUN_MINIMO = 24;
+// Vitórias seguidas de um lado do merge que ativam o modo galope
+constexpr ptrdiff_t MINIMO_GALOPE = 7;
+
+// upper_bound por busca exponencial a partir do início: O(log d), onde d
+// é a distância até a resposta (o caso comum no galope)
+template <class RandomIt, class T, class Compare>
+RandomIt galoparSuperior(RandomIt first, RandomIt last, const T& valor, Compare comp) {
+    ptrdiff_t n = last - first;
+    ptrdiff_t passo = 1;
+    ptrdiff_t anterior = 0;
+    while (passo < n && !comp(valor, first[passo])) {
+        anterior = passo;
+        passo = 2 * passo + 1;
+    }
+    return upper_bound(first + anterior, first + min(passo, n), valor, comp);
+}
+
+// lower_bound por busca exponencial a partir do início
+template <class RandomIt, class T, class Compare>
+RandomIt galoparInferior(RandomIt first, RandomIt last, const T& valor, Compare comp) {
+    ptrdiff_t n = last - first;
+    ptrdiff_t passo = 1;
+    ptrdiff_t anterior = 0;
+    while (passo < n && comp(first[passo], valor)) {
+        anterior = passo;
+        passo = 2 * passo + 1;
+    }
+    return lower_bound(first + anterior, first + min(passo, n), valor, comp);
+}
+
+// Mesmas buscas, mas exponenciais a partir do fim (merge de trás para frente)
+template <class RandomIt, class T, class Compare>
+RandomIt galoparSuperiorDoFim(RandomIt first, RandomIt last, const T& valor, Compare comp) {
+    ptrdiff_t n = last - first;
+    ptrdiff_t passo = 1;
+    ptrdiff_t anterior = 0;
+    while (passo <= n && comp(valor, last[-passo])) {
+        anterior = passo;
+        passo = 2 * passo + 1;
+    }
+    return upper_bound(last - min(passo, n), last - anterior, valor, comp);
+}
+
+template <class RandomIt, class T, class Compare>
+RandomIt galoparInferiorDoFim(RandomIt first, RandomIt last, const T& valor, Compare comp) {
+    ptrdiff_t n = last - first;
+    ptrdiff_t passo = 1;
+    ptrdiff_t anterior = 0;
+    while (passo <= n && !comp(last[-passo], valor)) {
+        anterior = passo;
+        passo = 2 * passo + 1;
+    }
+    return lower_bound(last - min(passo, n), last - anterior, valor, comp);
+}
+
+// Insertion sort binário estável de [first, last), sabendo que
+// [first, ordenadoAte) já está ordenado
+template <class RandomIt, class Compare>
+void insercaoBinaria(RandomIt first, RandomIt ordenadoAte, RandomIt last, Compare comp) {
+    for (RandomIt atual = ordenadoAte; atual < last; ++atual) {
+        auto valor = std::move(*atual);
+        RandomIt destino = upper_bound(first, atual, valor, comp);
+        move_backward(destino, atual, atual + 1);
+        *destino = std::move(valor);
+    }
+}
+
+// Fim do run natural que começa em first, estendido até RUN_MINIMO.
+// Runs estritamente decrescentes são invertidos (a desigualdade estrita
+// mantém a estabilidade).
+template <class RandomIt, class Compare>
+RandomIt estenderRun(RandomIt first, RandomIt last, Compare comp) {
+    RandomIt fim = first + 1;
+    if (fim == last) return fim;
+
+    if (comp(*fim, *first)) {
+        while (fim + 1 < last && comp(fim[1], *fim)) ++fim;
+        ++fim;
+        reverse(first, fim);
+    } else {
+        while (fim + 1 < last && !comp(fim[1], *fim)) ++fim;
+        ++fim;
+    }
+
+    if (fim - first < RUN_MINIMO) {
+        RandomIt estendido = first + min<ptrdiff_t>(RUN_MINIMO, last - first);
+        insercaoBinaria(first, fim, estendido, comp);
+        fim = estendido;
+    }
+    return fim;
+}
+
+// Merge estável de [first, meio) e [meio, last), ambos ordenados. Os
+// trechos já no lugar são descartados por galope; o menor lado restante
+// vai para o buffer. Ao vencer MINIMO_GALOPE vezes seguidas, um lado
+// copia blocos inteiros localizados por busca exponencial.
+template <class RandomIt, class Compare, class T>
+void mesclarComGalope(RandomIt first, RandomIt meio, RandomIt last, Compare comp,
+                      vector<T>& buffer) {
+    if (first == meio || meio == last) return;
+
+    // Elementos de A que não passam de B[0] já estão no lugar, assim como
+    // os de B que não ficam abaixo do último de A
+    first = galoparSuperior(first, meio, *meio, comp);
+    if (first == meio) return;
+    last = galoparInferiorDoFim(meio, last, *(meio - 1), comp);
+    if (meio == last) return;
+
+    if (meio - first <= last - meio) {
+        // A no buffer, merge da esquerda para a direita
+        buffer.assign(make_move_iterator(first), make_move_iterator(meio));
+        auto a = buffer.begin();
+        auto fimA = buffer.end();
+        RandomIt b = meio;
+        RandomIt saida = first;
+        ptrdiff_t vitoriasA = 0, vitoriasB = 0;
+
+        while (a != fimA && b != last) {
+            if (comp(*b, *a)) {
+                *saida++ = std::move(*b++);
+                vitoriasB++;
+                vitoriasA = 0;
+            } else {
+                *saida++ = std::move(*a++);
+                vitoriasA++;
+                vitoriasB = 0;
+            }
+
+            if (vitoriasA >= MINIMO_GALOPE && a != fimA && b != last) {
+                auto ate = galoparSuperior(a, fimA, *b, comp);
+                saida = move(a, ate, saida);
+                a = ate;
+                vitoriasA = 0;
+            } else if (vitoriasB >= MINIMO_GALOPE && a != fimA && b != last) {
+                RandomIt ate = galoparInferior(b, last, *a, comp);
+                saida = move(b, ate, saida);
+                b = ate;
+                vitoriasB = 0;
+            }
+        }
+        move(a, fimA, saida);
+    } else {
+        // B no buffer, merge da direita para a esquerda
+        buffer.assign(make_move_iterator(meio), make_move_iterator(last));
+        RandomIt fimA = meio;
+        auto fimB = buffer.end();
+        RandomIt saida = last;
+        ptrdiff_t vitoriasA = 0, vitoriasB = 0;
+
+        while (fimA != first && fimB != buffer.begin()) {
+            if (comp(*(fimB - 1), *(fimA - 1))) {
+                *--saida = std::move(*--fimA);
+                vitoriasA++;
+                vitoriasB = 0;
+            } else {
+                *--saida = std::move(*--fimB);
+                vitoriasB++;
+                vitoriasA = 0;
+            }
+
+            if (vitoriasA >= MINIMO_GALOPE && fimA != first && fimB != buffer.begin()) {
+                RandomIt desde = galoparSuperiorDoFim(first, fimA, *(fimB - 1), comp);
+                saida = move_backward(desde, fimA, saida);
+                fimA = desde;
+                vitoriasA = 0;
+            } else if (vitoriasB >= MINIMO_GALOPE && fimA != first && fimB != buffer.begin()) {
+                auto desde = galoparInferiorDoFim(buffer.begin(), fimB, *(fimA - 1), comp);
+                saida = move_backward(desde, fimB, saida);
+                fimB = desde;
+                vitoriasB = 0;
+            }
+        }
+        move_backward(buffer.begin(), fimB, saida);
+    }
+}
+
+// Potência do nó entre os runs A = [inicioA, inicioB) e B = [inicioB, fimB)
+// na árvore de merge quase ótima (Munro e Wild): número de bits iniciais
+// comuns aos pontos médios de A e B, normalizados por n, mais um
+inline int potenciaNo(ptrdiff_t n, ptrdiff_t inicioA, ptrdiff_t inicioB, ptrdiff_t fimB) {
+    uint64_t l = static_cast<uint64_t>(inicioA) + inicioB;
+    uint64_t r = static_cast<uint64_t>(inicioB) + fimB;
+    uint64_t total = n;
+    int bitsComuns = 0;
+    bool digitoA = l >= total, digitoB = r >= total;
+    while (digitoA == digitoB) {
+        bitsComuns++;
+        if (digitoA) {
+            l -= total;
+            r -= total;
+        }
+        l <<= 1;
+        r <<= 1;
+        digitoA = l >= total;
+        digitoB = r >= total;
+    }
+    return bitsComuns + 1;
+}
+
+}
+
+// Powersort (Munro e Wild, 2018): runs naturais mesclados na ordem dada
+// pelas potências dos nós, com merge galopante no estilo do TimSort.
+// Estável; O(n) em entradas ordenadas ou invertidas, O(n log n) no pior caso.
+template <class RandomIt, class Compare = less<>>
+void powersort(RandomIt first, RandomIt last, Compare comp = Compare()) {
+    using namespace detalhe_adaptativa;
+    using T = typename iterator_traits<RandomIt>::value_type;
+
+    ptrdiff_t n = last - first;
+    if (n <= 1) return;
+
+    struct Run {
+        ptrdiff_t inicio, fim;
+        int potencia;
+    };
+    vector<Run> pilha;
+    vector<T> buffer;
+    buffer.reserve(n / 2);
+
+    ptrdiff_t inicioA = 0;
+    ptrdiff_t fimA = estenderRun(first, last, comp) - first;
+
+    while (fimA < n) {
+        ptrdiff_t fimB = estenderRun(first + fimA, last, comp) - first;
+        int potencia = potenciaNo(n, inicioA, fimA, fimB);
+
+        // Runs na pilha com potência maior ficam abaixo deste nó na árvore
+        while (!pilha.empty() && pilha.back().potencia > potencia) {
+            mesclarComGalope(first + pilha.back().inicio, first + inicioA, first + fimA, comp, buffer);
+            inicioA = pilha.back().inicio;
+            pilha.pop_back();
+        }
+        pilha.push_back({inicioA, fimA, potencia});
+        inicioA = fimA;
+        fimA = fimB;
+    }
+
+    while (!pilha.empty()) {
+        mesclarComGalope(first + pilha.back().inicio, first + inicioA, first + fimA, comp, buffer);
+        inicioA = pilha.back().inicio;
+        pilha.pop_back();
+    }
+}
+
+// Reordenação incremental: [first, meio) já está ordenado e [meio, last)
+// é um lote novo (linhas acrescentadas). Ordena só o lote e mescla:
+// O(n + k log k) em vez de O(n log n).
+template <class RandomIt, class Compare = less<>>
+void reordenarIncremental(RandomIt first, RandomIt meio, RandomIt last, Compare comp = Compare()) {
+    using T = typename iterator_traits<RandomIt>::value_type;
+
+    powersort(meio, last, comp);
+    vector<T> buffer;
+    detalhe_adaptativa::mesclarComGalope(first, meio, last, comp, buffer);
+}
+
+// Coluna ordenada com valores alterados nas posições dadas: retira as
+// posições alteradas (compactação estável), acrescenta os valores novos
+// no fim e reordena incrementalmente
+template <class T, class Compare = less<>>
+void atualizarOrdenado(vector<T>& dados, const vector<pair<size_t, T>>& alteracoes,
+                       Compare comp = Compare()) {
+    // Por posição, vale a última alteração (o stable_sort preserva a ordem
+    // em que foram feitas); posições fora da coluna são ignoradas
+    vector<pair<size_t, T>> ordenadas(alteracoes);
+    stable_sort(ordenadas.begin(), ordenadas.end(),
+                [](const pair<size_t, T>& a, const pair<size_t, T>& b) { return a.first < b.first; });
+
+    vector<size_t> posicoes;
+    vector<T> novos;
+    for (size_t i = 0; i < ordenadas.size(); i++) {
+        if (ordenadas[i].first >= dados.size()) break;
+        if (i + 1 < ordenadas.size() && ordenadas[i + 1].first == ordenadas[i].first) continue;
+        posicoes.push_back(ordenadas[i].first);
+        novos.push_back(std::move(ordenadas[i].second));
+    }
+    if (posicoes.empty()) return;
+
+    size_t destino = 0, proxima = 0;
+    for (size_t i = 0; i < dados.size(); i++) {
+        if (proxima < posicoes.size() && posicoes[proxima] == i) {
+            proxima++;
+            continue;
+        }
+        if (destino != i) dados[destino] = std::move(dados[i]);
+        destino++;
+    }
+
+    dados.resize(destino);
+    dados.insert(dados.end(), novos.begin(), novos.end());
+    reordenarIncremental(dados.begin(), dados.begin() + destino, dados.end(), comp);
+}
+
+}
+
+#endif
@@ -0,0 +1,171 @@
+#include "ordenacao_celulas.h"
+#include "algoritmos_ordenacao.h"
+#include <algorithm>
+
+using namespace std;
+
+namespace {
+
+// Índice de monostate em ValorCelula
+const size_t INDICE_VAZIA = 3;
+
+// Posição do tipo na ordem crescente; as vazias ficam fora dessa ordem
+int ordemDoTipo(TipoCelula tipo) {
+    return static_cast<int>(tipo);
+}
+
+// -1, 0, 1 entre duas células não vazias do mesmo tipo
+int compararMesmoTipo(const ValorCelula& a, const ValorCelula& b, Colacao colacao) {
+    switch (a.index()) {
+        case 0: {
+            double x = get<double>(a), y = get<double>(b);
+            return x < y ? -1 : (y < x ? 1 : 0);
+        }
+        case 1:
+            return OrdenacaoTexto::compararColacao(get<string>(a), get<string>(b), colacao);
+        case 2:
+            return OrdenacaoTexto::compararColacao(get<ErroCelula>(a).codigo,
+                                                   get<ErroCelula>(b).codigo, Colacao::Binaria);
+        default:
+            return 0;
+    }
+}
+
+// Comparação de duas células da coluna na ordem pedida (para verificação)
+int compararCelulas(const ColunaCelulas& coluna, size_t i, size_t j, bool crescente,
+                    Colacao colacao) {
+    TipoCelula a = coluna.tipo(i), b = coluna.tipo(j);
+    if (a == TipoCelula::Vazia || b == TipoCelula::Vazia) {
+        return (a == TipoCelula::Vazia) - (b == TipoCelula::Vazia);
+    }
+    int resultado;
+    if (a != b) {
+        resultado = ordemDoTipo(a) < ordemDoTipo(b) ? -1 : 1;
+    } else if (a == TipoCelula::Numero) {
+        double x = coluna.numero(i), y = coluna.numero(j);
+        resultado = x < y ? -1 : (y < x ? 1 : 0);
+    } else {
+        resultado = OrdenacaoTexto::compararColacao(
+            coluna.texto(i), coluna.texto(j), a == TipoCelula::Texto ? colacao : Colacao::Binaria);
+    }
+    return crescente ? resultado : -resultado;
+}
+
+}
+
+vector<size_t> OrdenacaoCelulas::ordenarTextos(const ColunaTexto& textos, bool crescente,
+                                               Colacao colacao) {
+    ColunaTexto chaves = OrdenacaoTexto::gerarChaves(textos, colacao);
+    OrdenacaoTexto::msdRadixSort(chaves);
+    vector<size_t> linhas = OrdenacaoTexto::linhasDasChaves(chaves);
+    if (crescente) return linhas;
+
+    // Decrescente estável: inverte cada grupo de chaves iguais (sem os 4
+    // bytes do índice) e depois a sequência inteira; dentro do grupo a
+    // ordem original volta a ser a crescente
+    size_t inicio = 0;
+    while (inicio < linhas.size()) {
+        string_view chave = chaves[inicio];
+        chave.remove_suffix(4);
+        size_t fim = inicio + 1;
+        while (fim < linhas.size()) {
+            string_view proxima = chaves[fim];
+            proxima.remove_suffix(4);
+            if (proxima != chave) break;
+            fim++;
+        }
+        reverse(linhas.begin() + inicio, linhas.begin() + fim);
+        inicio = fim;
+    }
+    reverse(linhas.begin(), linhas.end());
+    return linhas;
+}
+
+void OrdenacaoCelulas::ordenarParticionado(ColunaCelulas& coluna, bool crescente, Colacao colacao) {
+    // Partição linear: só as etiquetas decidem o segmento; a carga só é
+    // lida para as células numéricas
+    const vector<TipoCelula>& tipos = coluna.tipos();
+    vector<double> numeros;
+    numeros.reserve(coluna.size() - coluna.textos().size() - coluna.erros().size());
+    size_t vazias = 0;
+    for (size_t i = 0; i < tipos.size(); i++) {
+        if (tipos[i] == TipoCelula::Numero) {
+            numeros.push_back(coluna.numero(i));
+        } else if (tipos[i] == TipoCelula::Vazia) {
+            vazias++;
+        }
+    }
+
+    if (numeros.size() >= LIMITE_RADIX) {
+        AlgoritmosOrdenacao::radixSort(numeros);
+    } else {
+        AlgoritmosOrdenacao::introsort(numeros);
+    }
+    // Empates numéricos são indistinguíveis (mesmo valor), então inverter
+    // já é a ordem decrescente estável
+    if (!crescente) reverse(numeros.begin(), numeros.end());
+
+    // Textos e erros entram nas ColunaTexto na ordem da coluna, então
+    // ordenar as linhas delas já dá a ordem estável das células
+    vector<size_t> ordemTextos = ordenarTextos(coluna.textos(), crescente, colacao);
+    vector<size_t> ordemErros = ordenarTextos(coluna.erros(), crescente, Colacao::Binaria);
+
+    coluna.reconstruir(numeros, ordemTextos, ordemErros, vazias, crescente);
+}
+
+void OrdenacaoCelulas::ordenarGenerico(vector<ValorCelula>& valores, bool crescente,
+                                       Colacao colacao) {
+    stable_sort(valores.begin(), valores.end(),
+                [crescente, colacao](const ValorCelula& a, const ValorCelula& b) {
+                    size_t tipoA = a.index(), tipoB = b.index();
+                    if (tipoA == INDICE_VAZIA || tipoB == INDICE_VAZIA) {
+                        return tipoA != INDICE_VAZIA && tipoB == INDICE_VAZIA;
+                    }
+                    if (tipoA != tipoB) return crescente ? tipoA < tipoB : tipoA > tipoB;
+                    int resultado = compararMesmoTipo(a, b, colacao);
+                    return crescente ? resultado < 0 : resultado > 0;
+                });
+}
+
+vector<ValorCelula> OrdenacaoCelulas::paraVariantes(const ColunaCelulas& coluna) {
+    vector<ValorCelula> valores;
+    valores.reserve(coluna.size());
+    for (size_t i = 0; i < coluna.size(); i++) {
+        switch (coluna.tipo(i)) {
+            case TipoCelula::Numero: valores.emplace_back(coluna.numero(i)); break;
+            case TipoCelula::Texto: valores.emplace_back(string(coluna.texto(i))); break;
+            case TipoCelula::Erro: valores.emplace_back(ErroCelula{string(coluna.texto(i))}); break;
+            case TipoCelula::Vazia: valores.emplace_back(monostate()); break;
+        }
+    }
+    return valores;
+}
+
+bool OrdenacaoCelulas::iguais(const ColunaCelulas& coluna, const vector<ValorCelula>& valores) {
+    if (coluna.size() != valores.size()) return false;
+    for (size_t i = 0; i < valores.size(); i++) {
+        if (static_cast<size_t>(ordemDoTipo(coluna.tipo(i))) != valores[i].index()) return false;
+        switch (coluna.tipo(i)) {
+            case TipoCelula::Numero:
+                if (coluna.numero(i) != get<double>(valores[i])) return false;
+                break;
+            case TipoCelula::Texto:
+                if (coluna.texto(i) != get<string>(valores[i])) return false;
+                break;
+            case TipoCelula::Erro:
+                if (coluna.texto(i) != get<ErroCelula>(valores[i]).codigo) return false;
+                break;
+            case TipoCelula::Vazia:
+                break;
+        }
+    }
+    return true;
+}
+
+bool OrdenacaoCelulas::verificarOrdenacao(const ColunaCelulas& coluna, bool crescente,
+                                          Colacao colacao) {
+    for (size_t i = 1; i < coluna.size(); i++) {
+        if (compararCelulas(coluna, i - 1, i, crescente, colacao) > 0) return false;
+    }
+    return true;
+}
@@ -0,0 +1,53 @@
+#ifndef ORDENACAO_CELULAS_H
+#define ORDENACAO_CELULAS_H
+
+#include <string>
+#include <variant>
+#include <vector>
+#include "coluna_celulas.h"
+#include "ordenacao_texto.h"
+
+using namespace std;
+
+// Código de erro no comparador genérico (tipo distinto de string)
+struct ErroCelula {
+    string codigo;
+};
+
+// Célula como um programa genérico a guardaria: a posição na variant é a
+// ordem do tipo (número, texto, erro, vazia)
+using ValorCelula = variant<double, string, ErroCelula, monostate>;
+
+// Ordenação de colunas mistas com a semântica do Calc: números, textos,
+// erros e por fim as vazias (que continuam no fim na ordem decrescente).
+// Empates mantêm a ordem original nas duas estratégias.
+class OrdenacaoCelulas {
+public:
+    // Uma passada pelas etiquetas separa os tipos; cada segmento vai para
+    // o núcleo mais rápido do seu tipo: radix sort (introsort abaixo de
+    // LIMITE_RADIX) nos doubles, chaves de colação + MSD radix sort nos
+    // textos e nos erros. As vazias só são contadas.
+    static void ordenarParticionado(ColunaCelulas& coluna, bool crescente = true,
+                                    Colacao colacao = Colacao::Secundaria);
+
+    // stable_sort com um único comparador sobre variant: a cada comparação
+    // descobre os tipos e despacha (o caminho de uma implementação genérica)
+    static void ordenarGenerico(vector<ValorCelula>& valores, bool crescente = true,
+                                Colacao colacao = Colacao::Secundaria);
+
+    static vector<ValorCelula> paraVariantes(const ColunaCelulas& coluna);
+
+    // Mesmas células, na mesma ordem (números por valor, textos por bytes)
+    static bool iguais(const ColunaCelulas& coluna, const vector<ValorCelula>& valores);
+
+    static bool verificarOrdenacao(const ColunaCelulas& coluna, bool crescente = true,
+                                   Colacao colacao = Colacao::Secundaria);
+
+    static const size_t LIMITE_RADIX = 64;
+
+private:
+    // Linhas de 'textos' na ordem da colação, estável nos dois sentidos
+    static vector<size_t> ordenarTextos(const ColunaTexto& textos, bool crescente, Colacao colacao);
+};
+
+#endif
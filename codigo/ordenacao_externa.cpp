@@ -0,0 +1,386 @@
+#include "ordenacao_externa.h"
+#include "algoritmos_ordenacao.h"
+#include "ordenacao_generica.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <future>
+#include <iostream>
+#include <memory>
+
+using namespace std;
+
+namespace {
+
+// Menor bloco de E/S por fluxo durante o merge
+const size_t BLOCO_MINIMO = 64 * 1024;
+
+// Leitor com leitura antecipada: enquanto o bloco atual é consumido, o
+// próximo já está sendo lido em segundo plano
+class LeitorBloco {
+public:
+    LeitorBloco(const string& nomeArquivo, size_t elementosPorBloco, uint64_t& bytesLidos)
+        : arquivo(fopen(nomeArquivo.c_str(), "rb")), capacidade(elementosPorBloco),
+          bytesLidos(bytesLidos) {
+        if (!arquivo) return;
+        setvbuf(arquivo, nullptr, _IONBF, 0);
+        atual.resize(capacidade);
+        proximo.resize(capacidade);
+        leituraPendente = async(launch::async, [this] { return lerBloco(proximo); });
+        trocarBloco();
+    }
+
+    ~LeitorBloco() {
+        if (leituraPendente.valid()) leituraPendente.wait();
+        if (arquivo) fclose(arquivo);
+    }
+
+    bool aberto() const { return arquivo != nullptr; }
+    bool fim() const { return posicao >= tamanho; }
+
+    // Leitura curta por erro de E/S (não por fim de arquivo); válido
+    // depois de fim()
+    bool falhou() const { return erroLeitura; }
+    double valor() const { return atual[posicao]; }
+
+    void avancar() {
+        if (++posicao >= tamanho && tamanho == capacidade) trocarBloco();
+    }
+
+private:
+    FILE* arquivo;
+    size_t capacidade;
+    uint64_t& bytesLidos;
+    vector<double> atual, proximo;
+    size_t posicao = 0, tamanho = 0;
+    future<size_t> leituraPendente;
+    bool erroLeitura = false;   // escrito na thread da leitura, lido após get()
+
+    size_t lerBloco(vector<double>& destino) {
+        size_t lidos = fread(destino.data(), sizeof(double), destino.size(), arquivo);
+        if (lidos < destino.size() && ferror(arquivo)) erroLeitura = true;
+        return lidos;
+    }
+
+    void trocarBloco() {
+        tamanho = leituraPendente.get();
+        bytesLidos += tamanho * sizeof(double);
+        swap(atual, proximo);
+        posicao = 0;
+        if (tamanho == capacidade) {
+            leituraPendente = async(launch::async, [this] { return lerBloco(proximo); });
+        }
+    }
+};
+
+// Escritor com gravação em segundo plano do bloco cheio
+class EscritorBloco {
+public:
+    EscritorBloco(const string& nomeArquivo, size_t elementosPorBloco, uint64_t& bytesEscritos)
+        : arquivo(fopen(nomeArquivo.c_str(), "wb")), bytesEscritos(bytesEscritos) {
+        if (!arquivo) return;
+        setvbuf(arquivo, nullptr, _IONBF, 0);
+        atual.reserve(elementosPorBloco);
+        emGravacao.reserve(elementosPorBloco);
+    }
+
+    ~EscritorBloco() { fechar(); }
+
+    bool aberto() const { return arquivo != nullptr; }
+
+    void escrever(double valor) {
+        atual.push_back(valor);
+        if (atual.size() == atual.capacity()) descarregar();
+    }
+
+    bool fechar() {
+        if (!arquivo) return ok;
+        descarregar();
+        aguardar();
+        ok = fclose(arquivo) == 0 && ok;
+        arquivo = nullptr;
+        return ok;
+    }
+
+private:
+    FILE* arquivo;
+    uint64_t& bytesEscritos;
+    vector<double> atual, emGravacao;
+    future<bool> gravacaoPendente;
+    bool ok = true;
+
+    void aguardar() {
+        if (gravacaoPendente.valid()) ok = gravacaoPendente.get() && ok;
+    }
+
+    void descarregar() {
+        if (atual.empty()) return;
+        aguardar();
+        swap(atual, emGravacao);
+        atual.clear();
+        bytesEscritos += emGravacao.size() * sizeof(double);
+        gravacaoPendente = async(launch::async, [this] {
+            return fwrite(emGravacao.data(), sizeof(double), emGravacao.size(), arquivo) ==
+                   emGravacao.size();
+        });
+    }
+};
+
+// Árvore de perdedores sobre k fluxos: cada nó interno guarda o perdedor
+// da partida, a raiz (arvore[0]) o vencedor. Substituir o vencedor custa
+// log2(k) comparações, sem as trocas de um heap.
+class ArvorePerdedores {
+public:
+    explicit ArvorePerdedores(vector<unique_ptr<LeitorBloco>>& fluxos)
+        : fluxos(fluxos), k(fluxos.size()), arvore(k) {
+        arvore[0] = jogar(1);
+    }
+
+    int vencedor() const { return arvore[0]; }
+    bool vazia() const { return fluxos[arvore[0]]->fim(); }
+
+    // Chamado após avançar o fluxo vencedor
+    void recalcular() {
+        int atual = arvore[0];
+        for (size_t no = (atual + k) / 2; no >= 1; no /= 2) {
+            if (menor(arvore[no], atual)) swap(arvore[no], atual);
+        }
+        arvore[0] = atual;
+    }
+
+private:
+    vector<unique_ptr<LeitorBloco>>& fluxos;
+    size_t k;
+    vector<int> arvore;
+
+    // Fluxos esgotados perdem para todos
+    bool menor(int a, int b) const {
+        if (fluxos[a]->fim()) return false;
+        if (fluxos[b]->fim()) return true;
+        return fluxos[a]->valor() < fluxos[b]->valor();
+    }
+
+    int jogar(size_t no) {
+        if (no >= k) return static_cast<int>(no - k);
+        int a = jogar(2 * no);
+        int b = jogar(2 * no + 1);
+        if (menor(b, a)) swap(a, b);
+        arvore[no] = b;
+        return a;
+    }
+};
+
+}
+
+bool OrdenacaoExterna::ordenarArquivo(const string& entrada, const string& saida, size_t memoriaBytes,
+                                      EstatisticasOrdenacaoExterna* estatisticas) {
+    auto inicio = chrono::high_resolution_clock::now();
+    EstatisticasOrdenacaoExterna est;
+    memoriaBytes = max(memoriaBytes, MEMORIA_MINIMA);
+
+    vector<string> runs;
+    if (!gerarRuns(entrada, saida + ".run", memoriaBytes, runs, est)) {
+        for (const string& run : runs) remove(run.c_str());
+        return false;
+    }
+    est.runs = runs.size();
+
+    // Fan-in máximo: dois blocos por entrada (atual + antecipado) e dois na saída
+    size_t fanIn = max<size_t>(2, memoriaBytes / (2 * BLOCO_MINIMO) - 1);
+    bool ok = true;
+
+    if (runs.empty()) {
+        // Entrada vazia: saída vazia
+        FILE* vazio = fopen(saida.c_str(), "wb");
+        ok = vazio && fclose(vazio) == 0;
+    }
+
+    while (ok && runs.size() > 1) {
+        bool ultimaPassada = runs.size() <= fanIn;
+        vector<string> proximos;
+
+        for (size_t i = 0; i < runs.size(); i += fanIn) {
+            vector<string> grupo(runs.begin() + i, runs.begin() + min(runs.size(), i + fanIn));
+            string destino = ultimaPassada ? saida
+                                           : saida + ".merge" + to_string(est.passadasMerge) +
+                                                 "_" + to_string(proximos.size());
+            ok = ok && intercalar(grupo, destino, memoriaBytes, est);
+            for (const string& run : grupo) remove(run.c_str());
+            proximos.push_back(destino);
+        }
+
+        est.passadasMerge++;
+        runs = proximos;
+    }
+
+    // Um único run já é a saída ordenada
+    if (ok && runs.size() == 1 && runs[0] != saida) {
+        ok = rename(runs[0].c_str(), saida.c_str()) == 0;
+    }
+    // Sem saída parcial: a última passada pode ter falhado no meio
+    if (!ok) {
+        for (const string& run : runs) remove(run.c_str());
+        remove(saida.c_str());
+    }
+
+    auto fim = chrono::high_resolution_clock::now();
+    est.tempoMs = chrono::duration_cast<chrono::microseconds>(fim - inicio).count() / 1000.0;
+    if (estatisticas) *estatisticas = est;
+    return ok;
+}
+
+bool OrdenacaoExterna::gerarRuns(const string& entrada, const string& prefixo, size_t memoriaBytes,
+                                 vector<string>& runs, EstatisticasOrdenacaoExterna& estatisticas) {
+    FILE* arquivo = fopen(entrada.c_str(), "rb");
+    if (!arquivo) {
+        cerr << "Erro ao abrir arquivo: " << entrada << endl;
+        return false;
+    }
+
+    // Metade do orçamento para o run em ordenação, metade para o run em gravação
+    size_t elementosPorRun = memoriaBytes / 2 / sizeof(double);
+    vector<double> bloco(elementosPorRun);
+    vector<double> emGravacao;
+    emGravacao.reserve(elementosPorRun);
+    future<bool> gravacaoPendente;
+    bool ok = true;
+
+    while (ok) {
+        bloco.resize(elementosPorRun);
+        size_t lidos = fread(bloco.data(), sizeof(double), elementosPorRun, arquivo);
+        if (lidos < elementosPorRun && ferror(arquivo)) {
+            cerr << "Erro ao ler arquivo: " << entrada << endl;
+            ok = false;
+            break;
+        }
+        if (lidos == 0) break;
+
+        bloco.resize(lidos);
+        estatisticas.elementos += lidos;
+        estatisticas.bytesLidos += lidos * sizeof(double);
+        AlgoritmosOrdenacao::introsort(bloco);
+
+        if (gravacaoPendente.valid()) ok = gravacaoPendente.get();
+
+        string nomeRun = prefixo + to_string(runs.size());
+        runs.push_back(nomeRun);
+        swap(bloco, emGravacao);
+        estatisticas.bytesEscritos += lidos * sizeof(double);
+
+        gravacaoPendente = async(launch::async, [&emGravacao, nomeRun]() {
+            FILE* run = fopen(nomeRun.c_str(), "wb");
+            if (!run) return false;
+            bool gravado = fwrite(emGravacao.data(), sizeof(double), emGravacao.size(), run) ==
+                           emGravacao.size();
+            return fclose(run) == 0 && gravado;
+        });
+
+        if (lidos < elementosPorRun) break;
+    }
+
+    if (gravacaoPendente.valid()) ok = gravacaoPendente.get() && ok;
+    fclose(arquivo);
+
+    if (!ok) cerr << "Erro ao gerar runs da ordenação externa" << endl;
+    return ok;
+}
+
+bool OrdenacaoExterna::intercalar(const vector<string>& entradas, const string& saida,
+                                  size_t memoriaBytes, EstatisticasOrdenacaoExterna& estatisticas) {
+    size_t k = entradas.size();
+    size_t bytesBloco = max(BLOCO_MINIMO, memoriaBytes / (2 * (k + 1)));
+    size_t elementosBloco = bytesBloco / sizeof(double);
+
+    vector<unique_ptr<LeitorBloco>> fluxos;
+    for (const string& entrada : entradas) {
+        fluxos.push_back(make_unique<LeitorBloco>(entrada, elementosBloco, estatisticas.bytesLidos));
+        if (!fluxos.back()->aberto()) {
+            cerr << "Erro ao abrir run: " << entrada << endl;
+            return false;
+        }
+    }
+
+    EscritorBloco escritor(saida, elementosBloco, estatisticas.bytesEscritos);
+    if (!escritor.aberto()) {
+        cerr << "Erro ao criar arquivo: " << saida << endl;
+        return false;
+    }
+
+    ArvorePerdedores arvore(fluxos);
+    while (!arvore.vazia()) {
+        LeitorBloco& fluxo = *fluxos[arvore.vencedor()];
+        escritor.escrever(fluxo.valor());
+        fluxo.avancar();
+        arvore.recalcular();
+    }
+
+    bool lidos = true;
+    for (size_t i = 0; i < k; i++) {
+        if (fluxos[i]->falhou()) {
+            cerr << "Erro ao ler run: " << entradas[i] << endl;
+            lidos = false;
+        }
+    }
+    return escritor.fechar() && lidos;
+}
+
+bool OrdenacaoExterna::gravarArquivoBruto(const string& nomeArquivo, const double* dados, size_t n,
+                                          size_t repeticoes) {
+    FILE* arquivo = fopen(nomeArquivo.c_str(), "wb");
+    if (!arquivo) {
+        cerr << "Erro ao criar arquivo: " << nomeArquivo << endl;
+        return false;
+    }
+
+    bool ok = true;
+    for (size_t r = 0; r < repeticoes && ok; r++) {
+        ok = fwrite(dados, sizeof(double), n, arquivo) == n;
+    }
+    return fclose(arquivo) == 0 && ok;
+}
+
+bool OrdenacaoExterna::topK(const string& nomeArquivo, size_t k, vector<double>& resultado,
+                            bool maiores) {
+    uint64_t bytesLidos = 0;
+    LeitorBloco leitor(nomeArquivo, (1 << 20) / sizeof(double), bytesLidos);
+    if (!leitor.aberto()) {
+        cerr << "Erro ao abrir arquivo: " << nomeArquivo << endl;
+        return false;
+    }
+
+    if (maiores) {
+        ordenacao::TopK<double, greater<>> selecao(k);
+        for (; !leitor.fim(); leitor.avancar()) selecao.adicionar(leitor.valor());
+        resultado = selecao.resultado();
+    } else {
+        ordenacao::TopK<double> selecao(k);
+        for (; !leitor.fim(); leitor.avancar()) selecao.adicionar(leitor.valor());
+        resultado = selecao.resultado();
+    }
+    if (leitor.falhou()) {
+        cerr << "Erro ao ler arquivo: " << nomeArquivo << endl;
+        return false;
+    }
+    return true;
+}
+
+bool OrdenacaoExterna::verificarArquivo(const string& nomeArquivo, uint64_t* elementos) {
+    uint64_t bytesLidos = 0;
+    LeitorBloco leitor(nomeArquivo, (1 << 20) / sizeof(double), bytesLidos);
+    if (!leitor.aberto()) return false;
+
+    bool ordenado = true;
+    uint64_t total = 0;
+    double anterior = 0;
+    for (; !leitor.fim(); leitor.avancar(), total++) {
+        if (total > 0 && leitor.valor() < anterior) ordenado = false;
+        anterior = leitor.valor();
+    }
+
+    if (elementos) *elementos = total;
+    if (leitor.falhou()) {
+        cerr << "Erro ao ler arquivo: " << nomeArquivo << endl;
+        return false;
+    }
+    return ordenado;
+}
@@ -0,0 +1,56 @@
+#ifndef ORDENACAO_EXTERNA_H
+#define ORDENACAO_EXTERNA_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+struct EstatisticasOrdenacaoExterna {
+    uint64_t elementos = 0;
+    size_t runs = 0;
+    size_t passadasMerge = 0;
+    uint64_t bytesLidos = 0;
+    uint64_t bytesEscritos = 0;
+    double tempoMs = 0;
+};
+
+// Ordenação externa (out-of-core) de arquivos binários de doubles
+// (formato bruto, 8 bytes por valor, sem cabeçalho).
+// 1) Runs: blocos que cabem no orçamento de memória são ordenados com o
+//    Introsort manual e gravados em arquivos temporários; a gravação de um
+//    run acontece em segundo plano enquanto o próximo é lido e ordenado.
+// 2) Merge: k-way com árvore de perdedores, leitura antecipada por run e
+//    escrita em segundo plano. Se houver mais runs que o fan-in permitido
+//    pelo orçamento, são feitas várias passadas.
+class OrdenacaoExterna {
+public:
+    static const size_t MEMORIA_MINIMA = 1 << 20;
+
+    static bool ordenarArquivo(const string& entrada, const string& saida, size_t memoriaBytes,
+                               EstatisticasOrdenacaoExterna* estatisticas = nullptr);
+
+    // Grava 'repeticoes' cópias dos dados em formato bruto (para montar
+    // entradas maiores que a memória a partir de uma coluna real)
+    static bool gravarArquivoBruto(const string& nomeArquivo, const double* dados, size_t n,
+                                   size_t repeticoes = 1);
+
+    // Os k menores (ou maiores) valores do arquivo, em ordem, lidos em
+    // fluxo com memória O(k + bloco): não precisa ordenar o arquivo
+    static bool topK(const string& nomeArquivo, size_t k, vector<double>& resultado,
+                     bool maiores = false);
+
+    // Verifica a ordenação lendo o arquivo em fluxo
+    static bool verificarArquivo(const string& nomeArquivo, uint64_t* elementos = nullptr);
+
+private:
+    static bool gerarRuns(const string& entrada, const string& prefixo, size_t memoriaBytes,
+                          vector<string>& runs, EstatisticasOrdenacaoExterna& estatisticas);
+
+    static bool intercalar(const vector<string>& entradas, const string& saida, size_t memoriaBytes,
+                           EstatisticasOrdenacaoExterna& estatisticas);
+};
+
+#endif
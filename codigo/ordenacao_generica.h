@@ -0,0 +1,850 @@
+#ifndef ORDENACAO_GENERICA_H
+#define ORDENACAO_GENERICA_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "arena_memoria.h"
+#include "contagem_operacoes.h"
+#include "sequencias_shell.h"
+
+using namespace std;
+
+// Versões genéricas (header-only) dos algoritmos de AlgoritmosOrdenacao,
+// sobre iteradores de acesso aleatório, tipo de valor e comparador.
+// Os índices usam ptrdiff_t, sem o limite de 2^31 elementos do int.
+namespace ordenacao {
+
+// Características por tipo de chave, resolvidas em tempo de compilação
+template <class T>
+struct TraitsChave {
+    // Partições com até este tamanho vão para o insertion sort no introsort.
+    // Tipos aritméticos pequenos são baratos de mover, então o limiar cresce.
+    static constexpr ptrdiff_t LIMIAR_INSERCAO =
+        is_arithmetic<T>::value ? (sizeof(T) <= 4 ? 24 : 16) : 8;
+};
+
+// Comparação sem desvio (partição de Lomuto com troca incondicional) só
+// vale para inteiros com a ordem natural: o resultado vira aritmética
+template <class T, class Compare>
+struct UsaParticaoSemDesvio
+    : integral_constant<bool, is_integral<T>::value &&
+                                  (is_same<Compare, less<T>>::value ||
+                                   is_same<Compare, less<>>::value)> {};
+
+// Cada núcleo abaixo tem uma versão com a política de contagem como último
+// parâmetro (ContagemOperacoes ou SemContagem, ver contagem_operacoes.h) e
+// a versão de sempre, que repassa SemContagem e compila sem custo extra.
+
+// Insertion Sort
+template <class RandomIt, class Compare, class Politica>
+void insertionSort(RandomIt first, RandomIt last, Compare comp, Politica& politica) {
+    ptrdiff_t n = last - first;
+    for (ptrdiff_t i = 1; i < n; i++) {
+        auto key = std::move(first[i]);
+        ptrdiff_t j = i - 1;
+
+        while (j >= 0 && comp(key, first[j])) {
+            first[j + 1] = std::move(first[j]);
+            j--;
+        }
+        first[j + 1] = std::move(key);
+        politica.moverElementos(i - j + 1);
+    }
+}
+
+template <class RandomIt, class Compare = less<>>
+void insertionSort(RandomIt first, RandomIt last, Compare comp = Compare()) {
+    SemContagem semContagem;
+    insertionSort(first, last, comp, semContagem);
+}
+
+// Uma passada do Shell Sort: insertion sort em cada uma das gap cadeias.
+// O laço avança i de 1 em 1, então posições consecutivas pertencem a
+// cadeias diferentes e as faltas de cache dos gaps grandes já se
+// sobrepõem (intercalar 4 cadeias à mão mediu mais lento).
+template <class RandomIt, class Compare, class Politica>
+void passadaShell(RandomIt first, ptrdiff_t n, ptrdiff_t gap, Compare comp, Politica& politica) {
+    for (ptrdiff_t i = gap; i < n; i++) {
+        auto temp = std::move(first[i]);
+        ptrdiff_t j;
+
+        for (j = i; j >= gap && comp(temp, first[j - gap]); j -= gap) {
+            first[j] = std::move(first[j - gap]);
+        }
+        first[j] = std::move(temp);
+        politica.moverElementos((i - j) / gap + 2);
+    }
+}
+
+// Shell Sort com a sequência de gaps escolhida em tempo de compilação
+// (sequencias_shell.h); o padrão é a sequência original n/2, n/4, ..., 1
+template <class Sequencia = SequenciaShell, class RandomIt, class Compare, class Politica>
+void shellSort(RandomIt first, RandomIt last, Compare comp, Politica& politica) {
+    ptrdiff_t n = last - first;
+    Sequencia::percorrer(n, [&](ptrdiff_t gap) { passadaShell(first, n, gap, comp, politica); });
+}
+
+template <class Sequencia = SequenciaShell, class RandomIt, class Compare = less<>>
+void shellSort(RandomIt first, RandomIt last, Compare comp = Compare()) {
+    SemContagem semContagem;
+    shellSort<Sequencia>(first, last, comp, semContagem);
+}
+
+// Partição de Lomuto com pivô no último elemento; retorna a posição final
+// do pivô. Elementos antes dele são menores, os demais maiores ou iguais.
+template <class RandomIt, class Compare, class Politica>
+RandomIt partition(RandomIt first, RandomIt last, Compare comp, Politica& politica) {
+    using T = typename iterator_traits<RandomIt>::value_type;
+    RandomIt high = last - 1;
+    T pivot = *high;
+    RandomIt i = first;
+
+    if constexpr (UsaParticaoSemDesvio<T, Compare>::value) {
+        // Troca sempre e avança i pelo resultado da comparação: se o
+        // elemento não for menor, troca dois valores >= pivô entre si
+        for (RandomIt j = first; j < high; ++j) {
+            T valor = *j;
+            *j = *i;
+            *i = valor;
+            i += static_cast<ptrdiff_t>(comp(valor, pivot));
+        }
+        politica.moverElementos(2 * (high - first));
+    } else {
+        for (RandomIt j = first; j < high; ++j) {
+            if (comp(*j, pivot)) {
+                iter_swap(i, j);
+                politica.trocarElementos(1);
+                ++i;
+            }
+        }
+    }
+    iter_swap(i, high);
+    politica.trocarElementos(1);
+    return i;
+}
+
+template <class RandomIt, class Compare = less<>>
+RandomIt partition(RandomIt first, RandomIt last, Compare comp = Compare()) {
+    SemContagem semContagem;
+    return ordenacao::partition(first, last, comp, semContagem);
+}
+
+// Quick Sort: recursão no lado menor e laço no maior (mesmas partições
+// da versão recursiva dupla, mas pilha limitada a O(log n))
+template <class RandomIt, class Compare, class Politica>
+void quickSort(RandomIt first, RandomIt last, Compare comp, Politica& politica) {
+    politica.entrarRecursao();
+    while (last - first > 1) {
+        RandomIt pivot = ordenacao::partition(first, last, comp, politica);
+
+        if (pivot - first < last - pivot) {
+            quickSort(first, pivot, comp, politica);
+            first = pivot + 1;
+        } else {
+            quickSort(pivot + 1, last, comp, politica);
+            last = pivot;
+        }
+    }
+    politica.sairRecursao();
+}
+
+template <class RandomIt, class Compare = less<>>
+void quickSort(RandomIt first, RandomIt last, Compare comp = Compare()) {
+    SemContagem semContagem;
+    quickSort(first, last, comp, semContagem);
+}
+
+// Desce o elemento i no heap de n elementos a partir de first
+template <class RandomIt, class Compare, class Politica>
+void heapify(RandomIt first, ptrdiff_t n, ptrdiff_t i, Compare comp, Politica& politica) {
+    while (true) {
+        ptrdiff_t largest = i;
+        ptrdiff_t left = 2 * i + 1;
+        ptrdiff_t right = 2 * i + 2;
+
+        if (left < n && comp(first[largest], first[left]))
+            largest = left;
+
+        if (right < n && comp(first[largest], first[right]))
+            largest = right;
+
+        if (largest == i) return;
+
+        iter_swap(first + i, first + largest);
+        politica.trocarElementos(1);
+        i = largest;
+    }
+}
+
+template <class RandomIt, class Compare = less<>>
+void heapify(RandomIt first, ptrdiff_t n, ptrdiff_t i, Compare comp = Compare()) {
+    SemContagem semContagem;
+    heapify(first, n, i, comp, semContagem);
+}
+
+template <class RandomIt, class Compare, class Politica>
+void heapSort(RandomIt first, RandomIt last, Compare comp, Politica& politica) {
+    ptrdiff_t n = last - first;
+
+    // Constrói o heap
+    for (ptrdiff_t i = n / 2 - 1; i >= 0; i--) {
+        heapify(first, n, i, comp, politica);
+    }
+
+    // Extrai elementos do heap
+    for (ptrdiff_t i = n - 1; i > 0; i--) {
+        iter_swap(first, first + i);
+        politica.trocarElementos(1);
+        heapify(first, i, ptrdiff_t(0), comp, politica);
+    }
+}
+
+template <class RandomIt, class Compare = less<>>
+void heapSort(RandomIt first, RandomIt last, Compare comp = Compare()) {
+    SemContagem semContagem;
+    heapSort(first, last, comp, semContagem);
+}
+
+inline int calculateDepthLimit(ptrdiff_t n) {
+    return 2 * static_cast<int>(log2(static_cast<double>(n)));
+}
+
+template <class RandomIt, class Compare, class Politica>
+void introsortUtil(RandomIt first, RandomIt last, int depthLimit, Compare comp, Politica& politica) {
+    using T = typename iterator_traits<RandomIt>::value_type;
+    politica.entrarRecursao();
+
+    while (true) {
+        ptrdiff_t size = last - first;
+
+        // Se o tamanho for pequeno, usa insertion sort
+        if (size <= TraitsChave<T>::LIMIAR_INSERCAO) {
+            politica.registrarFolhaInsercao();
+            insertionSort(first, last, comp, politica);
+            break;
+        }
+
+        // Se a profundidade limite foi atingida, usa heap sort
+        if (depthLimit == 0) {
+            politica.registrarFallbackHeapSort();
+            heapSort(first, last, comp, politica);
+            break;
+        }
+
+        // Caso contrário, usa quick sort (laço no lado direito)
+        RandomIt pivot = ordenacao::partition(first, last, comp, politica);
+        depthLimit--;
+        introsortUtil(first, pivot, depthLimit, comp, politica);
+        first = pivot + 1;
+    }
+    politica.sairRecursao();
+}
+
+template <class RandomIt, class Compare = less<>>
+void introsortUtil(RandomIt first, RandomIt last, int depthLimit, Compare comp = Compare()) {
+    SemContagem semContagem;
+    introsortUtil(first, last, depthLimit, comp, semContagem);
+}
+
+template <class RandomIt, class Compare, class Politica>
+void introsort(RandomIt first, RandomIt last, Compare comp, Politica& politica) {
+    if (last - first <= 1) return;
+    introsortUtil(first, last, calculateDepthLimit(last - first), comp, politica);
+}
+
+template <class RandomIt, class Compare = less<>>
+void introsort(RandomIt first, RandomIt last, Compare comp = Compare()) {
+    SemContagem semContagem;
+    introsort(first, last, comp, semContagem);
+}
+
+namespace detalhe_merge {
+
+// Intercala [first, meio) e [meio, last) em destino; em empate vence o
+// lado esquerdo, o que mantém a ordenação estável
+template <class InputIt, class OutputIt, class Compare>
+void intercalar(InputIt first, InputIt meio, InputIt last, OutputIt destino, Compare comp) {
+    InputIt esquerda = first, direita = meio;
+    while (esquerda != meio && direita != last) {
+        if (comp(*direita, *esquerda)) *destino++ = std::move(*direita++);
+        else *destino++ = std::move(*esquerda++);
+    }
+    destino = std::move(esquerda, meio, destino);
+    std::move(direita, last, destino);
+}
+
+// Uma passada do merge bottom-up: pares de runs de 'largura' elementos
+// de origem vão intercalados para destino
+template <class InputIt, class OutputIt, class Compare>
+void passadaMerge(InputIt origem, ptrdiff_t n, ptrdiff_t largura, OutputIt destino, Compare comp) {
+    for (ptrdiff_t inicio = 0; inicio < n; inicio += 2 * largura) {
+        ptrdiff_t meio = min(inicio + largura, n);
+        ptrdiff_t fim = min(inicio + 2 * largura, n);
+
+        // Runs já em ordem entre si (entrada ordenada ou quase) só são copiados
+        if (meio == fim || !comp(origem[meio], origem[meio - 1])) {
+            std::move(origem + inicio, origem + fim, destino + inicio);
+        } else {
+            intercalar(origem + inicio, origem + meio, origem + fim, destino + inicio, comp);
+        }
+    }
+}
+
+}
+
+// Merge Sort estável bottom-up: runs base de LIMIAR_INSERCAO elementos
+// ordenados por inserção e passadas que alternam entre o array e um
+// buffer do mesmo tamanho. O buffer vem da arena, então ordenações
+// repetidas reaproveitam a mesma memória sem alocar a cada chamada.
+template <class RandomIt, class Compare>
+void mergeSort(RandomIt first, RandomIt last, Compare comp, ArenaMemoria& arena) {
+    using T = typename iterator_traits<RandomIt>::value_type;
+    ptrdiff_t n = last - first;
+    const ptrdiff_t run = TraitsChave<T>::LIMIAR_INSERCAO;
+
+    for (ptrdiff_t inicio = 0; inicio < n; inicio += run) {
+        insertionSort(first + inicio, first + min(inicio + run, n), comp);
+    }
+    if (n <= run) return;
+
+    ArenaMemoria::Escopo escopo(arena);
+    T* buffer = arena.alocar<T>(n);
+
+    // Tipos triviais podem ser escritos direto na memória crua; os demais
+    // precisam de objetos construídos, então a primeira cópia vai ao buffer
+    bool noBuffer = !is_trivially_copyable<T>::value;
+    if (noBuffer) uninitialized_move(first, last, buffer);
+
+    for (ptrdiff_t largura = run; largura < n; largura *= 2) {
+        if (noBuffer) detalhe_merge::passadaMerge(buffer, n, largura, first, comp);
+        else detalhe_merge::passadaMerge(first, n, largura, buffer, comp);
+        noBuffer = !noBuffer;
+    }
+    if (noBuffer) std::move(buffer, buffer + n, first);
+
+    if (!is_trivially_copyable<T>::value) {
+        for (ptrdiff_t i = 0; i < n; i++) buffer[i].~T();
+    }
+}
+
+template <class RandomIt, class Compare = less<>>
+void mergeSort(RandomIt first, RandomIt last, Compare comp = Compare()) {
+    mergeSort(first, last, comp, ArenaMemoria::daThread());
+}
+
+// Partição de três vias (bandeira holandesa) em torno de pivot: devolve
+// [inicio, fim) dos elementos equivalentes ao pivô. Usada pela seleção
+// determinística, em que muitos iguais degradariam a partição de Lomuto.
+template <class RandomIt, class T, class Compare>
+pair<RandomIt, RandomIt> partitionTresVias(RandomIt first, RandomIt last, const T& pivot,
+                                           Compare comp) {
+    RandomIt menores = first, atual = first, maiores = last;
+    while (atual < maiores) {
+        if (comp(*atual, pivot)) {
+            iter_swap(menores++, atual++);
+        } else if (comp(pivot, *atual)) {
+            iter_swap(atual, --maiores);
+        } else {
+            ++atual;
+        }
+    }
+    return make_pair(menores, maiores);
+}
+
+template <class RandomIt, class Compare>
+void nthElementDeterministico(RandomIt first, RandomIt nth, RandomIt last, Compare comp);
+
+// Mediana das medianas de grupos de 5: as medianas são levadas para o
+// início da faixa e a mediana delas é selecionada recursivamente
+template <class RandomIt, class Compare>
+RandomIt medianOfMedians(RandomIt first, RandomIt last, Compare comp) {
+    ptrdiff_t n = last - first;
+    if (n <= 5) {
+        insertionSort(first, last, comp);
+        return first + (n - 1) / 2;
+    }
+
+    RandomIt destino = first;
+    for (RandomIt grupo = first; grupo < last; grupo += 5) {
+        RandomIt fimGrupo = grupo + min<ptrdiff_t>(5, last - grupo);
+        insertionSort(grupo, fimGrupo, comp);
+        iter_swap(destino++, grupo + (fimGrupo - grupo - 1) / 2);
+    }
+
+    RandomIt mediana = first + (destino - first - 1) / 2;
+    nthElementDeterministico(first, mediana, destino, comp);
+    return mediana;
+}
+
+// Seleção em O(n) no pior caso (Blum, Floyd, Pratt, Rivest e Tarjan)
+template <class RandomIt, class Compare>
+void nthElementDeterministico(RandomIt first, RandomIt nth, RandomIt last, Compare comp) {
+    using T = typename iterator_traits<RandomIt>::value_type;
+
+    while (last - first > TraitsChave<T>::LIMIAR_INSERCAO) {
+        T pivot = *medianOfMedians(first, last, comp);
+        pair<RandomIt, RandomIt> iguais = partitionTresVias(first, last, pivot, comp);
+
+        if (nth < iguais.first) last = iguais.first;
+        else if (nth >= iguais.second) first = iguais.second;
+        else return;
+    }
+    insertionSort(first, last, comp);
+}
+
+// Introselect: quickselect com pivô mediana de 3 e a partição de Lomuto
+// do Quick Sort; depois de 2*log2(n) partições cai para a seleção
+// determinística (mediana das medianas). Ao final *nth é o elemento que
+// estaria ali com a faixa ordenada, sem nenhum maior antes nem menor depois.
+template <class RandomIt, class Compare = less<>>
+void nthElement(RandomIt first, RandomIt nth, RandomIt last, Compare comp = Compare()) {
+    using T = typename iterator_traits<RandomIt>::value_type;
+    if (nth >= last || last - first <= 1) return;
+
+    int depthLimit = calculateDepthLimit(last - first);
+    while (last - first > TraitsChave<T>::LIMIAR_INSERCAO) {
+        if (depthLimit-- == 0) {
+            nthElementDeterministico(first, nth, last, comp);
+            return;
+        }
+
+        // Mediana de first, meio e last - 1 vai para a posição do pivô
+        RandomIt meio = first + (last - first) / 2;
+        RandomIt high = last - 1;
+        if (comp(*meio, *first)) iter_swap(meio, first);
+        if (comp(*high, *first)) iter_swap(high, first);
+        if (comp(*meio, *high)) iter_swap(meio, high);
+
+        RandomIt pivot = ordenacao::partition(first, last, comp);
+        if (pivot == nth) return;
+        if (nth < pivot) last = pivot;
+        else first = pivot + 1;
+    }
+    insertionSort(first, last, comp);
+}
+
+// Partial sort: os k menores de [first, last) ordenados em [first, middle).
+// Com k pequeno em relação a n, max-heap dos k menores: O(n log k), mas em
+// entradas decrescentes cada elemento desce o heap inteiro. Com k maior
+// a seleção seguida do introsort do prefixo custa O(n + k log k).
+template <class RandomIt, class Compare = less<>>
+void partialSort(RandomIt first, RandomIt middle, RandomIt last, Compare comp = Compare()) {
+    using T = typename iterator_traits<RandomIt>::value_type;
+    ptrdiff_t k = middle - first;
+    ptrdiff_t n = last - first;
+    if (k <= 0) return;
+
+    if (k > max<ptrdiff_t>(TraitsChave<T>::LIMIAR_INSERCAO, n / 1024)) {
+        nthElement(first, middle - 1, last, comp);
+        introsort(first, middle, comp);
+        return;
+    }
+
+    for (ptrdiff_t i = k / 2 - 1; i >= 0; i--) {
+        heapify(first, k, i, comp);
+    }
+    for (RandomIt it = middle; it < last; ++it) {
+        if (comp(*it, *first)) {
+            iter_swap(it, first);
+            heapify(first, k, ptrdiff_t(0), comp);
+        }
+    }
+    for (ptrdiff_t i = k - 1; i > 0; i--) {
+        iter_swap(first, first + i);
+        heapify(first, i, ptrdiff_t(0), comp);
+    }
+}
+
+// Top-k em fluxo: guarda os k menores já vistos num max-heap, com memória
+// O(k) independente do tamanho da entrada (use greater<> para os maiores)
+template <class T, class Compare = less<>>
+class TopK {
+public:
+    explicit TopK(size_t k, Compare comp = Compare()) : k(k), comp(comp) { heap.reserve(k); }
+
+    void adicionar(const T& valor) {
+        if (heap.size() < k) {
+            heap.push_back(valor);
+            // Sobe o novo elemento enquanto for maior que o pai
+            ptrdiff_t i = heap.size() - 1;
+            while (i > 0 && comp(heap[(i - 1) / 2], heap[i])) {
+                swap(heap[(i - 1) / 2], heap[i]);
+                i = (i - 1) / 2;
+            }
+        } else if (k > 0 && comp(valor, heap[0])) {
+            heap[0] = valor;
+            heapify(heap.begin(), static_cast<ptrdiff_t>(k), ptrdiff_t(0), comp);
+        }
+    }
+
+    void adicionar(const T* dados, size_t n) {
+        for (size_t i = 0; i < n; i++) adicionar(dados[i]);
+    }
+
+    // Os k menores em ordem crescente (segundo comp)
+    vector<T> resultado() const {
+        vector<T> ordenados(heap);
+        ptrdiff_t n = ordenados.size();
+        for (ptrdiff_t i = n - 1; i > 0; i--) {
+            swap(ordenados[0], ordenados[i]);
+            heapify(ordenados.begin(), i, ptrdiff_t(0), comp);
+        }
+        return ordenados;
+    }
+
+private:
+    size_t k;
+    Compare comp;
+    vector<T> heap;
+};
+
+// Pattern-defeating quicksort (pdqsort, Orson Peters): introsort com pivô
+// mediana de 3 / ninther, detecção de partições já prontas (entradas
+// ordenadas ou quase), partição à esquerda para muitos elementos iguais,
+// embaralhamento determinístico após partições ruins e heap sort como
+// último recurso. Para tipos aritméticos com a ordem natural a partição
+// é em blocos sem desvios (BlockQuicksort, Edelkamp e Weiss).
+namespace detalhe_pdq {
+
+constexpr ptrdiff_t LIMIAR_INSERCAO = 24;
+constexpr ptrdiff_t LIMIAR_NINTHER = 128;
+constexpr ptrdiff_t LIMITE_INSERCAO_PARCIAL = 8;
+constexpr ptrdiff_t TAMANHO_BLOCO = 64;
+
+template <class T, class Compare>
+struct UsaParticaoEmBlocos
+    : integral_constant<bool, is_arithmetic<T>::value &&
+                                  (is_same<Compare, less<T>>::value ||
+                                   is_same<Compare, less<>>::value)> {};
+
+// Insertion sort sem verificação de limite: exige que *(first - 1) não
+// seja maior que nenhum elemento de [first, last)
+template <class RandomIt, class Compare>
+void unguardedInsertionSort(RandomIt first, RandomIt last, Compare comp) {
+    if (first == last) return;
+
+    for (RandomIt atual = first + 1; atual != last; ++atual) {
+        RandomIt destino = atual;
+        RandomIt anterior = atual - 1;
+
+        if (comp(*destino, *anterior)) {
+            auto valor = std::move(*destino);
+            do {
+                *destino-- = std::move(*anterior);
+            } while (comp(valor, *--anterior));
+            *destino = std::move(valor);
+        }
+    }
+}
+
+// Insertion sort que desiste (retorna false) depois de mover mais que
+// LIMITE_INSERCAO_PARCIAL elementos: barato em trechos quase ordenados
+template <class RandomIt, class Compare>
+bool partialInsertionSort(RandomIt first, RandomIt last, Compare comp) {
+    if (first == last) return true;
+
+    ptrdiff_t movidos = 0;
+    for (RandomIt atual = first + 1; atual != last; ++atual) {
+        RandomIt destino = atual;
+        RandomIt anterior = atual - 1;
+
+        if (comp(*destino, *anterior)) {
+            auto valor = std::move(*destino);
+            do {
+                *destino-- = std::move(*anterior);
+            } while (destino != first && comp(valor, *--anterior));
+            *destino = std::move(valor);
+            movidos += atual - destino;
+        }
+
+        if (movidos > LIMITE_INSERCAO_PARCIAL) return false;
+    }
+    return true;
+}
+
+template <class RandomIt, class Compare>
+void sort2(RandomIt a, RandomIt b, Compare comp) {
+    if (comp(*b, *a)) iter_swap(a, b);
+}
+
+template <class RandomIt, class Compare>
+void sort3(RandomIt a, RandomIt b, RandomIt c, Compare comp) {
+    sort2(a, b, comp);
+    sort2(b, c, comp);
+    sort2(a, b, comp);
+}
+
+// Troca os pares (first + deslocEsq[i], last - deslocDir[i]). Com o mesmo
+// número de elementos nos dois lados usa trocas simples (mantém O(n) em
+// entradas decrescentes); senão, um ciclo de movimentos
+template <class RandomIt>
+void trocarDeslocamentos(RandomIt first, RandomIt last, const unsigned char* deslocEsq,
+                         const unsigned char* deslocDir, ptrdiff_t num, bool usarTrocas) {
+    if (usarTrocas) {
+        for (ptrdiff_t i = 0; i < num; i++) {
+            iter_swap(first + deslocEsq[i], last - deslocDir[i]);
+        }
+    } else if (num > 0) {
+        RandomIt esq = first + deslocEsq[0];
+        RandomIt dir = last - deslocDir[0];
+        auto valor = std::move(*esq);
+        *esq = std::move(*dir);
+        for (ptrdiff_t i = 1; i < num; i++) {
+            esq = first + deslocEsq[i];
+            *dir = std::move(*esq);
+            dir = last - deslocDir[i];
+            *esq = std::move(*dir);
+        }
+        *dir = std::move(valor);
+    }
+}
+
+// Partição com pivô *first: menores à esquerda, maiores ou iguais à
+// direita. Retorna a posição final do pivô e se a faixa já estava
+// particionada (nenhuma troca necessária).
+template <class RandomIt, class Compare>
+pair<RandomIt, bool> partitionRight(RandomIt begin, RandomIt end, Compare comp) {
+    auto pivot = std::move(*begin);
+    RandomIt first = begin;
+    RandomIt last = end;
+
+    // A mediana de 3 garante um elemento >= pivô antes do fim; na direita
+    // só há sentinela se a esquerda avançou
+    while (comp(*++first, pivot));
+    if (first - 1 == begin) {
+        while (first < last && !comp(*--last, pivot));
+    } else {
+        while (!comp(*--last, pivot));
+    }
+
+    bool jaParticionado = first >= last;
+    while (first < last) {
+        iter_swap(first, last);
+        while (comp(*++first, pivot));
+        while (!comp(*--last, pivot));
+    }
+
+    RandomIt posicaoPivo = first - 1;
+    *begin = std::move(*posicaoPivo);
+    *posicaoPivo = std::move(pivot);
+    return make_pair(posicaoPivo, jaParticionado);
+}
+
+// Mesma partição, mas os elementos do lado errado são marcados em blocos
+// de TAMANHO_BLOCO deslocamentos (o resultado da comparação só incrementa
+// um contador, sem desvio) e trocados depois em lote
+template <class RandomIt, class Compare>
+pair<RandomIt, bool> partitionRightBranchless(RandomIt begin, RandomIt end, Compare comp) {
+    auto pivot = std::move(*begin);
+    RandomIt first = begin;
+    RandomIt last = end;
+
+    while (comp(*++first, pivot));
+    if (first - 1 == begin) {
+        while (first < last && !comp(*--last, pivot));
+    } else {
+        while (!comp(*--last, pivot));
+    }
+
+    bool jaParticionado = first >= last;
+    if (!jaParticionado) {
+        iter_swap(first, last);
+        ++first;
+
+        alignas(64) unsigned char deslocEsq[TAMANHO_BLOCO];
+        alignas(64) unsigned char deslocDir[TAMANHO_BLOCO];
+        RandomIt baseEsq = first;
+        RandomIt baseDir = last;
+        ptrdiff_t numEsq = 0, numDir = 0, inicioEsq = 0, inicioDir = 0;
+
+        while (first < last) {
+            // Quantos elementos ainda desconhecidos vão para cada bloco
+            ptrdiff_t desconhecidos = last - first;
+            ptrdiff_t divisaoEsq = numEsq == 0 ? (numDir == 0 ? desconhecidos / 2 : desconhecidos) : 0;
+            ptrdiff_t divisaoDir = numDir == 0 ? (desconhecidos - divisaoEsq) : 0;
+
+            // Preenche os blocos com os elementos do lado errado
+            ptrdiff_t limiteEsq = min(divisaoEsq, TAMANHO_BLOCO);
+            for (ptrdiff_t i = 0; i < limiteEsq; i++) {
+                deslocEsq[numEsq] = static_cast<unsigned char>(i);
+                numEsq += !comp(*first, pivot);
+                ++first;
+            }
+
+            ptrdiff_t limiteDir = min(divisaoDir, TAMANHO_BLOCO);
+            for (ptrdiff_t i = 0; i < limiteDir; i++) {
+                deslocDir[numDir] = static_cast<unsigned char>(i + 1);
+                numDir += comp(*--last, pivot);
+            }
+
+            // Troca o que dá para parear e reinicia o bloco que esvaziou
+            ptrdiff_t num = min(numEsq, numDir);
+            trocarDeslocamentos(baseEsq, baseDir, deslocEsq + inicioEsq, deslocDir + inicioDir,
+                                num, numEsq == numDir);
+            numEsq -= num;
+            numDir -= num;
+            inicioEsq += num;
+            inicioDir += num;
+
+            if (numEsq == 0) {
+                inicioEsq = 0;
+                baseEsq = first;
+            }
+            if (numDir == 0) {
+                inicioDir = 0;
+                baseDir = last;
+            }
+        }
+
+        // Sobras de um dos blocos vão para a fronteira
+        if (numEsq) {
+            while (numEsq--) iter_swap(baseEsq + deslocEsq[inicioEsq + numEsq], --last);
+            first = last;
+        }
+        if (numDir) {
+            while (numDir--) iter_swap(baseDir - deslocDir[inicioDir + numDir], first), ++first;
+            last = first;
+        }
+    }
+
+    RandomIt posicaoPivo = first - 1;
+    *begin = std::move(*posicaoPivo);
+    *posicaoPivo = std::move(pivot);
+    return make_pair(posicaoPivo, jaParticionado);
+}
+
+// Partição com iguais ao pivô à esquerda; usada quando o pivô é igual ao
+// elemento logo antes da faixa, e então toda a parte esquerda é igual
+template <class RandomIt, class Compare>
+RandomIt partitionLeft(RandomIt begin, RandomIt end, Compare comp) {
+    auto pivot = std::move(*begin);
+    RandomIt first = begin;
+    RandomIt last = end;
+
+    while (comp(pivot, *--last));
+    if (last + 1 == end) {
+        while (first < last && !comp(pivot, *++first));
+    } else {
+        while (!comp(pivot, *++first));
+    }
+
+    while (first < last) {
+        iter_swap(first, last);
+        while (comp(pivot, *--last));
+        while (!comp(pivot, *++first));
+    }
+
+    RandomIt posicaoPivo = last;
+    *begin = std::move(*posicaoPivo);
+    *posicaoPivo = std::move(pivot);
+    return posicaoPivo;
+}
+
+template <bool EmBlocos, class RandomIt, class Compare>
+void pdqsortLoop(RandomIt begin, RandomIt end, Compare comp, int particoesRuins,
+                 bool maisAEsquerda) {
+    while (true) {
+        ptrdiff_t size = end - begin;
+
+        // Fora da faixa mais à esquerda, *(begin - 1) serve de sentinela
+        if (size < LIMIAR_INSERCAO) {
+            if (maisAEsquerda) insertionSort(begin, end, comp);
+            else unguardedInsertionSort(begin, end, comp);
+            return;
+        }
+
+        // Pivô em *begin: mediana de 3 ou, em faixas grandes, ninther
+        ptrdiff_t meio = size / 2;
+        if (size > LIMIAR_NINTHER) {
+            sort3(begin, begin + meio, end - 1, comp);
+            sort3(begin + 1, begin + (meio - 1), end - 2, comp);
+            sort3(begin + 2, begin + (meio + 1), end - 3, comp);
+            sort3(begin + (meio - 1), begin + meio, begin + (meio + 1), comp);
+            iter_swap(begin, begin + meio);
+        } else {
+            sort3(begin + meio, begin, end - 1, comp);
+        }
+
+        // Pivô igual ao elemento anterior à faixa: nada aqui é menor que
+        // ele, então os iguais ficam à esquerda e já estão ordenados
+        if (!maisAEsquerda && !comp(*(begin - 1), *begin)) {
+            begin = partitionLeft(begin, end, comp) + 1;
+            continue;
+        }
+
+        pair<RandomIt, bool> resultado = EmBlocos ? partitionRightBranchless(begin, end, comp)
+                                                  : partitionRight(begin, end, comp);
+        RandomIt posicaoPivo = resultado.first;
+        bool jaParticionado = resultado.second;
+
+        ptrdiff_t tamanhoEsq = posicaoPivo - begin;
+        ptrdiff_t tamanhoDir = end - (posicaoPivo + 1);
+        bool desbalanceado = tamanhoEsq < size / 8 || tamanhoDir < size / 8;
+
+        if (desbalanceado) {
+            // Partições ruins demais: garante O(n log n)
+            if (--particoesRuins == 0) {
+                heapSort(begin, end, comp);
+                return;
+            }
+
+            // Embaralha alguns elementos para quebrar padrões adversários
+            if (tamanhoEsq >= LIMIAR_INSERCAO) {
+                iter_swap(begin, begin + tamanhoEsq / 4);
+                iter_swap(posicaoPivo - 1, posicaoPivo - tamanhoEsq / 4);
+                if (tamanhoEsq > LIMIAR_NINTHER) {
+                    iter_swap(begin + 1, begin + (tamanhoEsq / 4 + 1));
+                    iter_swap(begin + 2, begin + (tamanhoEsq / 4 + 2));
+                    iter_swap(posicaoPivo - 2, posicaoPivo - (tamanhoEsq / 4 + 1));
+                    iter_swap(posicaoPivo - 3, posicaoPivo - (tamanhoEsq / 4 + 2));
+                }
+            }
+            if (tamanhoDir >= LIMIAR_INSERCAO) {
+                iter_swap(posicaoPivo + 1, posicaoPivo + (1 + tamanhoDir / 4));
+                iter_swap(end - 1, end - tamanhoDir / 4);
+                if (tamanhoDir > LIMIAR_NINTHER) {
+                    iter_swap(posicaoPivo + 2, posicaoPivo + (2 + tamanhoDir / 4));
+                    iter_swap(posicaoPivo + 3, posicaoPivo + (3 + tamanhoDir / 4));
+                    iter_swap(end - 2, end - (1 + tamanhoDir / 4));
+                    iter_swap(end - 3, end - (2 + tamanhoDir / 4));
+                }
+            }
+        } else if (jaParticionado && partialInsertionSort(begin, posicaoPivo, comp) &&
+                   partialInsertionSort(posicaoPivo + 1, end, comp)) {
+            // Partição balanceada sem trocas: provavelmente já ordenado
+            return;
+        }
+
+        // Recursão na esquerda e laço na direita
+        pdqsortLoop<EmBlocos>(begin, posicaoPivo, comp, particoesRuins, maisAEsquerda);
+        begin = posicaoPivo + 1;
+        maisAEsquerda = false;
+    }
+}
+
+}
+
+template <class RandomIt, class Compare = less<>>
+void pdqsort(RandomIt first, RandomIt last, Compare comp = Compare()) {
+    using T = typename iterator_traits<RandomIt>::value_type;
+    ptrdiff_t n = last - first;
+    if (n <= 1) return;
+
+    // Número de partições desbalanceadas toleradas antes do heap sort
+    int particoesRuins = 0;
+    for (ptrdiff_t k = n; k > 1; k >>= 1) particoesRuins++;
+
+    detalhe_pdq::pdqsortLoop<detalhe_pdq::UsaParticaoEmBlocos<T, Compare>::value>(
+        first, last, comp, particoesRuins, true);
+}
+
+}
+
+#endif
@@ -0,0 +1,192 @@
+#include "ordenacao_indireta.h"
+#include "algoritmos_ordenacao.h"
+#include "pool_tarefas.h"
+#include <algorithm>
+#include <atomic>
+
+using namespace std;
+
+vector<size_t> OrdenacaoIndireta::argsort(const vector<double>& chaves, bool crescente) {
+    size_t n = chaves.size();
+    vector<ParChaveIndice> pares(n);
+    for (size_t i = 0; i < n; i++) {
+        uint64_t chave = AlgoritmosOrdenacao::chaveCanonica(chaves[i]);
+        // Decrescente: complemento da chave; o LSD continua estável
+        pares[i] = {crescente ? chave : ~chave, i};
+    }
+
+    radixSortPares(pares);
+
+    vector<size_t> permutacao(n);
+    for (size_t i = 0; i < n; i++) permutacao[i] = pares[i].indice;
+    return permutacao;
+}
+
+// Mesmo esquema de AlgoritmosOrdenacao::radixSortLSD: os 8 histogramas
+// numa leitura só e passadas triviais puladas; cada passada move o par
+// inteiro (16 bytes) em vez de só a chave
+void OrdenacaoIndireta::radixSortPares(vector<ParChaveIndice>& pares) {
+    size_t n = pares.size();
+    if (n <= 1) return;
+    vector<size_t> histograma(8 * 256, 0);
+
+    for (size_t i = 0; i < n; i++) {
+        uint64_t chave = pares[i].chave;
+        for (int b = 0; b < 8; b++) {
+            histograma[b * 256 + ((chave >> (8 * b)) & 0xFF)]++;
+        }
+    }
+
+    vector<ParChaveIndice> temp(n);
+    ParChaveIndice* origem = pares.data();
+    ParChaveIndice* destino = temp.data();
+
+    for (int b = 0; b < 8; b++) {
+        size_t* contagem = &histograma[b * 256];
+        uint64_t byteQualquer = (origem[0].chave >> (8 * b)) & 0xFF;
+        if (contagem[byteQualquer] == n) continue;
+
+        size_t soma = 0;
+        for (int d = 0; d < 256; d++) {
+            size_t c = contagem[d];
+            contagem[d] = soma;
+            soma += c;
+        }
+
+        for (size_t i = 0; i < n; i++) {
+            destino[contagem[(origem[i].chave >> (8 * b)) & 0xFF]++] = origem[i];
+        }
+        swap(origem, destino);
+    }
+
+    if (origem != pares.data()) {
+        copy(origem, origem + n, pares.data());
+    }
+}
+
+vector<size_t> OrdenacaoIndireta::argsortIndireto(const vector<double>& chaves, bool crescente) {
+    vector<size_t> permutacao(chaves.size());
+    for (size_t i = 0; i < permutacao.size(); i++) permutacao[i] = i;
+    // Mesma chave canônica de argsort: as duas permutações coincidem
+    // também com ±0.0 e NaN
+    stable_sort(permutacao.begin(), permutacao.end(), [&chaves, crescente](size_t a, size_t b) {
+        uint64_t chaveA = AlgoritmosOrdenacao::chaveCanonica(chaves[a]);
+        uint64_t chaveB = AlgoritmosOrdenacao::chaveCanonica(chaves[b]);
+        return crescente ? chaveA < chaveB : chaveB < chaveA;
+    });
+    return permutacao;
+}
+
+void OrdenacaoIndireta::gather(vector<double>& coluna, const vector<size_t>& permutacao) {
+    vector<double> destino(permutacao.size());
+    for (size_t i = 0; i < permutacao.size(); i++) destino[i] = coluna[permutacao[i]];
+    coluna.swap(destino);
+}
+
+// As colunas andam em grupos de COLUNAS_POR_GRUPO: para cada bloco de
+// linhas, o trecho da permutação é lido uma vez e serve às colunas do
+// grupo. Depois da troca, o armazenamento antigo do grupo vira o destino
+// do grupo seguinte, então só COLUNAS_POR_GRUPO buffers são alocados.
+void OrdenacaoIndireta::gatherBlocos(vector<vector<double>*> colunas,
+                                     const vector<size_t>& permutacao) {
+    size_t n = permutacao.size();
+    size_t largura = min(COLUNAS_POR_GRUPO, colunas.size());
+    vector<vector<double>> destinos(largura, vector<double>(n));
+
+    for (size_t grupo = 0; grupo < colunas.size(); grupo += largura) {
+        size_t colunasGrupo = min(largura, colunas.size() - grupo);
+        for (size_t inicio = 0; inicio < n; inicio += LINHAS_POR_BLOCO) {
+            size_t fim = min(n, inicio + LINHAS_POR_BLOCO);
+            for (size_t c = 0; c < colunasGrupo; c++) {
+                const double* origem = colunas[grupo + c]->data();
+                double* destino = destinos[c].data();
+                for (size_t i = inicio; i < fim; i++) destino[i] = origem[permutacao[i]];
+            }
+        }
+        for (size_t c = 0; c < colunasGrupo; c++) colunas[grupo + c]->swap(destinos[c]);
+    }
+}
+
+vector<size_t> OrdenacaoIndireta::lideresCiclos(const vector<size_t>& permutacao) {
+    vector<size_t> lideres;
+    vector<bool> visitado(permutacao.size(), false);
+    for (size_t inicio = 0; inicio < permutacao.size(); inicio++) {
+        if (visitado[inicio] || permutacao[inicio] == inicio) continue;
+        lideres.push_back(inicio);
+        for (size_t j = inicio; !visitado[j]; j = permutacao[j]) visitado[j] = true;
+    }
+    return lideres;
+}
+
+// coluna[j] recebe coluna[permutacao[j]] ao longo do ciclo; o valor do
+// líder, sobrescrito primeiro, fecha o ciclo
+void OrdenacaoIndireta::seguirCiclos(vector<double>& coluna, const vector<size_t>& permutacao,
+                                     const vector<size_t>& lideres) {
+    for (size_t lider : lideres) {
+        double primeiro = coluna[lider];
+        size_t j = lider;
+        for (size_t proximo = permutacao[j]; proximo != lider; proximo = permutacao[j]) {
+            coluna[j] = coluna[proximo];
+            j = proximo;
+        }
+        coluna[j] = primeiro;
+    }
+}
+
+void OrdenacaoIndireta::aplicarPermutacao(TabelaColunas& tabela, const vector<size_t>& permutacao,
+                                          AplicacaoPermutacao aplicacao, unsigned numThreads) {
+    size_t numColunas = tabela.numColunas();
+    if (numColunas == 0 || permutacao.empty()) return;
+
+    vector<size_t> lideres;
+    if (aplicacao == AplicacaoPermutacao::Ciclos) lideres = lideresCiclos(permutacao);
+
+    // Colunas [primeira, ultima) de uma tarefa
+    auto reordenar = [&](size_t primeira, size_t ultima) {
+        switch (aplicacao) {
+            case AplicacaoPermutacao::Gather:
+                for (size_t c = primeira; c < ultima; c++) gather(tabela.colunas[c], permutacao);
+                break;
+            case AplicacaoPermutacao::GatherBlocos: {
+                vector<vector<double>*> grupo;
+                for (size_t c = primeira; c < ultima; c++) grupo.push_back(&tabela.colunas[c]);
+                gatherBlocos(grupo, permutacao);
+                break;
+            }
+            case AplicacaoPermutacao::Ciclos:
+                for (size_t c = primeira; c < ultima; c++) {
+                    seguirCiclos(tabela.colunas[c], permutacao, lideres);
+                }
+                break;
+        }
+    };
+
+    PoolTarefas* pool = numThreads == 1 ? nullptr : &PoolTarefas::compartilhado(numThreads);
+    size_t tarefas = pool ? min<size_t>(pool->numThreads(), numColunas) : 1;
+    if (tarefas <= 1) {
+        reordenar(0, numColunas);
+        return;
+    }
+
+    // Uma fatia contígua de colunas por thread: no gather em blocos cada
+    // fatia ainda compartilha a leitura da permutação entre suas colunas
+    atomic<size_t> pendentes(tarefas);
+    for (size_t t = 0; t < tarefas; t++) {
+        size_t primeira = numColunas * t / tarefas;
+        size_t ultima = numColunas * (t + 1) / tarefas;
+        pool->submeter([&reordenar, &pendentes, primeira, ultima]() {
+            reordenar(primeira, ultima);
+            pendentes--;
+        });
+    }
+    pool->aguardar(pendentes);
+}
+
+const char* OrdenacaoIndireta::nomeAplicacao(AplicacaoPermutacao aplicacao) {
+    switch (aplicacao) {
+        case AplicacaoPermutacao::Gather: return "gather";
+        case AplicacaoPermutacao::GatherBlocos: return "gather em blocos";
+        case AplicacaoPermutacao::Ciclos: return "ciclos in-place";
+    }
+    return "";
+}
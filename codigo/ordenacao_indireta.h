@@ -0,0 +1,64 @@
+#ifndef ORDENACAO_INDIRETA_H
+#define ORDENACAO_INDIRETA_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "tabela_colunas.h"
+
+using namespace std;
+
+// Como a permutação é levada às colunas:
+// - Gather: coluna a coluna, destino[i] = coluna[permutacao[i]] num buffer
+// - GatherBlocos: blocos de linhas; cada bloco da permutação é lido uma
+//   vez e fica no L1 enquanto alimenta todas as colunas
+// - Ciclos: in-place, seguindo os ciclos da permutação (sem buffer do
+//   tamanho da coluna; os líderes dos ciclos são calculados uma vez)
+enum class AplicacaoPermutacao { Gather, GatherBlocos, Ciclos };
+
+// Ordenação indireta (argsort) de uma coluna-chave e reordenação das
+// colunas companheiras, como o Calc faz ao ordenar um intervalo. As
+// permutações seguem OrdenacaoMultiChave: posição final -> linha original.
+class OrdenacaoIndireta {
+public:
+    // Pares (chave canônica de 64 bits, índice) ordenados juntos por
+    // radix LSD: o índice viaja com a chave, sem acesso indireto às
+    // chaves durante a ordenação. Estável nos dois sentidos; ±0.0 são
+    // empates e NaN vai para o fim (início na decrescente).
+    static vector<size_t> argsort(const vector<double>& chaves, bool crescente = true);
+
+    // Linha de base: stable_sort dos índices com o comparador indo à
+    // coluna-chave em cada comparação (mesma ordem de argsort)
+    static vector<size_t> argsortIndireto(const vector<double>& chaves, bool crescente = true);
+
+    // Reordena todas as colunas da tabela. numThreads > 1 distribui as
+    // colunas entre as threads do PoolTarefas compartilhado (0 = todos
+    // os núcleos)
+    static void aplicarPermutacao(TabelaColunas& tabela, const vector<size_t>& permutacao,
+                                  AplicacaoPermutacao aplicacao, unsigned numThreads = 1);
+
+    static const char* nomeAplicacao(AplicacaoPermutacao aplicacao);
+
+    // Gather em blocos: 2048 índices (16 KB) cabem no L1 e servem a 4
+    // colunas por vez, que também mantêm 4 leituras aleatórias em curso
+    static const size_t LINHAS_POR_BLOCO = 2048;
+    static const size_t COLUNAS_POR_GRUPO = 4;
+
+private:
+    struct ParChaveIndice {
+        uint64_t chave;
+        uint64_t indice;
+    };
+
+    static void radixSortPares(vector<ParChaveIndice>& pares);
+
+    static void gather(vector<double>& coluna, const vector<size_t>& permutacao);
+    static void gatherBlocos(vector<vector<double>*> colunas, const vector<size_t>& permutacao);
+    static void seguirCiclos(vector<double>& coluna, const vector<size_t>& permutacao,
+                             const vector<size_t>& lideres);
+
+    // Primeiro elemento de cada ciclo de comprimento > 1
+    static vector<size_t> lideresCiclos(const vector<size_t>& permutacao);
+};
+
+#endif
@@ -0,0 +1,135 @@
+#include "ordenacao_multichave.h"
+#include "algoritmos_ordenacao.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <numeric>
+
+using namespace std;
+
+vector<size_t> OrdenacaoMultiChave::ordenarLexicografico(const TabelaColunas& tabela,
+                                                         const vector<ChaveOrdenacao>& chaves) {
+    vector<size_t> permutacao(tabela.numLinhas());
+    iota(permutacao.begin(), permutacao.end(), 0);
+    
+    stable_sort(permutacao.begin(), permutacao.end(), [&](size_t a, size_t b) {
+        for (const ChaveOrdenacao& chave : chaves) {
+            // Mesma ordem do caminho empacotado: ±0.0 iguais, NaN por último
+            const vector<double>& coluna = tabela.colunas[chave.coluna];
+            uint64_t chaveA = AlgoritmosOrdenacao::chaveCanonica(coluna[a]);
+            uint64_t chaveB = AlgoritmosOrdenacao::chaveCanonica(coluna[b]);
+            if (chaveA == chaveB) continue;
+            return chave.crescente ? chaveA < chaveB : chaveB < chaveA;
+        }
+        return false;
+    });
+    
+    return permutacao;
+}
+
+int OrdenacaoMultiChave::larguraBits(unsigned long long valor) {
+    return valor == 0 ? 0 : 64 - __builtin_clzll(valor);
+}
+
+// Colunas só com inteiros (códigos) ocupam apenas os bits de (max - min);
+// as demais usam os 64 bits da chave canônica (NaN reprova o teste de
+// inteiro e cai aqui)
+OrdenacaoMultiChave::Campo OrdenacaoMultiChave::analisarCampo(const vector<double>& coluna) {
+    Campo campo = {false, 0.0, 64};
+    if (coluna.empty()) return campo;
+    
+    auto extremos = minmax_element(coluna.begin(), coluna.end());
+    double minimo = *extremos.first;
+    double maximo = *extremos.second;
+    
+    if (maximo - minimo >= 9.0e15) return campo;
+    for (double valor : coluna) {
+        if (valor != trunc(valor)) return campo;
+    }
+    
+    campo.inteiro = true;
+    campo.minimo = minimo;
+    campo.largura = larguraBits(static_cast<unsigned long long>(maximo - minimo));
+    return campo;
+}
+
+int OrdenacaoMultiChave::larguraEmpacotada(const TabelaColunas& tabela,
+                                           const vector<ChaveOrdenacao>& chaves) {
+    int total = larguraBits(tabela.numLinhas() > 0 ? tabela.numLinhas() - 1 : 0);
+    for (const ChaveOrdenacao& chave : chaves) {
+        total += analisarCampo(tabela.colunas[chave.coluna]).largura;
+    }
+    return total <= 128 ? total : 0;
+}
+
+template <class Chave>
+vector<size_t> OrdenacaoMultiChave::ordenarChaves(const TabelaColunas& tabela,
+                                                  const vector<ChaveOrdenacao>& chaves,
+                                                  const vector<Campo>& campos, int bitsIndice) {
+    size_t n = tabela.numLinhas();
+    vector<Chave> empacotadas(n);
+    
+    for (size_t linha = 0; linha < n; linha++) {
+        unsigned __int128 chaveLinha = 0;
+        
+        for (size_t k = 0; k < chaves.size(); k++) {
+            const Campo& campo = campos[k];
+            if (campo.largura == 0) continue;
+            
+            double valor = tabela.colunas[chaves[k].coluna][linha];
+            uint64_t bits = campo.inteiro ? static_cast<uint64_t>(valor - campo.minimo)
+                                          : AlgoritmosOrdenacao::chaveCanonica(valor);
+            
+            // Decrescente: complemento dentro da largura do campo
+            if (!chaves[k].crescente) {
+                uint64_t mascara = campo.largura == 64 ? ~0ULL : (1ULL << campo.largura) - 1;
+                bits = mascara - bits;
+            }
+            chaveLinha = (chaveLinha << campo.largura) | bits;
+        }
+        
+        // O índice nos bits baixos desempata e torna a ordenação estável
+        chaveLinha = (chaveLinha << bitsIndice) | linha;
+        empacotadas[linha] = static_cast<Chave>(chaveLinha);
+    }
+    
+    sort(empacotadas.begin(), empacotadas.end());
+    
+    const Chave mascaraIndice = (static_cast<Chave>(1) << bitsIndice) - 1;
+    vector<size_t> permutacao(n);
+    for (size_t i = 0; i < n; i++) {
+        permutacao[i] = static_cast<size_t>(empacotadas[i] & mascaraIndice);
+    }
+    return permutacao;
+}
+
+vector<size_t> OrdenacaoMultiChave::ordenarEmpacotado(const TabelaColunas& tabela,
+                                                      const vector<ChaveOrdenacao>& chaves) {
+    size_t n = tabela.numLinhas();
+    int bitsIndice = larguraBits(n > 0 ? n - 1 : 0);
+    
+    vector<Campo> campos;
+    int total = bitsIndice;
+    for (const ChaveOrdenacao& chave : chaves) {
+        campos.push_back(analisarCampo(tabela.colunas[chave.coluna]));
+        total += campos.back().largura;
+    }
+    
+    if (total <= 64) {
+        return ordenarChaves<uint64_t>(tabela, chaves, campos, bitsIndice);
+    }
+    if (total <= 128) {
+        return ordenarChaves<unsigned __int128>(tabela, chaves, campos, bitsIndice);
+    }
+    return ordenarLexicografico(tabela, chaves);
+}
+
+void OrdenacaoMultiChave::aplicarPermutacao(TabelaColunas& tabela, const vector<size_t>& permutacao) {
+    vector<double> temp(permutacao.size());
+    for (vector<double>& coluna : tabela.colunas) {
+        for (size_t i = 0; i < permutacao.size(); i++) {
+            temp[i] = coluna[permutacao[i]];
+        }
+        coluna.swap(temp);
+    }
+}
@@ -0,0 +1,53 @@
+#ifndef ORDENACAO_MULTICHAVE_H
+#define ORDENACAO_MULTICHAVE_H
+
+#include <vector>
+#include <cstddef>
+#include "tabela_colunas.h"
+
+using namespace std;
+
+// Critério de ordenação no estilo do Calc ("Ordenar por A, depois B, depois C")
+struct ChaveOrdenacao {
+    size_t coluna;
+    bool crescente;
+};
+
+// Ordenação de linhas por múltiplas chaves. Os métodos retornam a
+// permutação estável das linhas (posição final -> linha original).
+class OrdenacaoMultiChave {
+public:
+    // stable_sort dos índices com comparador encadeado chave a chave
+    static vector<size_t> ordenarLexicografico(const TabelaColunas& tabela,
+                                               const vector<ChaveOrdenacao>& chaves);
+    
+    // Normaliza as chaves em um inteiro de largura fixa (64 ou 128 bits) com
+    // o índice da linha nos bits baixos; a ordenação vira uma única
+    // comparação de inteiros. Recorre ao lexicográfico se não couber.
+    static vector<size_t> ordenarEmpacotado(const TabelaColunas& tabela,
+                                            const vector<ChaveOrdenacao>& chaves);
+    
+    // Bits necessários para o empacotamento (0 se não couber em 128)
+    static int larguraEmpacotada(const TabelaColunas& tabela,
+                                 const vector<ChaveOrdenacao>& chaves);
+    
+    // Reordena todas as colunas da tabela segundo a permutação
+    static void aplicarPermutacao(TabelaColunas& tabela, const vector<size_t>& permutacao);
+
+private:
+    struct Campo {
+        bool inteiro;      // deslocamento (v - minimo) em vez dos bits IEEE-754
+        double minimo;
+        int largura;
+    };
+    
+    static Campo analisarCampo(const vector<double>& coluna);
+    static int larguraBits(unsigned long long valor);
+    
+    template <class Chave>
+    static vector<size_t> ordenarChaves(const TabelaColunas& tabela,
+                                        const vector<ChaveOrdenacao>& chaves,
+                                        const vector<Campo>& campos, int bitsIndice);
+};
+
+#endif
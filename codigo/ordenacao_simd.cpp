@@ -0,0 +1,237 @@
+#include "ordenacao_simd.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <immintrin.h>
+
+using namespace std;
+
+#define ALVO_AVX2 __attribute__((target("avx2")))
+
+bool OrdenacaoSIMD::avx2Disponivel() {
+    static const bool disponivel = __builtin_cpu_supports("avx2");
+    return disponivel;
+}
+
+void OrdenacaoSIMD::ordenarBloco(double* dados, size_t n) {
+    if (n < 2) return;
+    
+    // NaN quebra min/max vetoriais; nesse caso usa o caminho escalar
+    if (n >= 4 && n <= TAMANHO_REDE && avx2Disponivel()) {
+        bool temNaN = false;
+        for (size_t i = 0; i < n; i++) {
+            temNaN |= std::isnan(dados[i]);
+        }
+        if (!temNaN) {
+            ordenarBlocoAVX2(dados, n);
+            return;
+        }
+    }
+    ordenarBlocoEscalar(dados, n);
+}
+
+size_t OrdenacaoSIMD::particionar(double* dados, size_t n, double pivo) {
+    if (avx2Disponivel()) {
+        return particionarAVX2(dados, n, pivo);
+    }
+    return particionarEscalar(dados, n, pivo);
+}
+
+// Insertion sort in-place (sem cópia para vetor auxiliar)
+void OrdenacaoSIMD::ordenarBlocoEscalar(double* dados, size_t n) {
+    for (size_t i = 1; i < n; i++) {
+        double key = dados[i];
+        size_t j = i;
+        while (j > 0 && dados[j - 1] > key) {
+            dados[j] = dados[j - 1];
+            j--;
+        }
+        dados[j] = key;
+    }
+}
+
+size_t OrdenacaoSIMD::particionarEscalar(double* dados, size_t n, double pivo) {
+    size_t esquerda = 0;
+    for (size_t i = 0; i < n; i++) {
+        if (dados[i] < pivo) {
+            swap(dados[esquerda], dados[i]);
+            esquerda++;
+        }
+    }
+    return esquerda;
+}
+
+namespace {
+
+// Comparador de rede aplicado lane a lane
+ALVO_AVX2 inline void compararTrocar(__m256d& a, __m256d& b) {
+    __m256d menor = _mm256_min_pd(a, b);
+    b = _mm256_max_pd(a, b);
+    a = menor;
+}
+
+ALVO_AVX2 inline __m256d inverter(__m256d v) {
+    return _mm256_permute4x64_pd(v, _MM_SHUFFLE(0, 1, 2, 3));
+}
+
+// Ordena um registrador bitônico (distâncias 2 e 1)
+ALVO_AVX2 inline __m256d limparBitonico4(__m256d v) {
+    __m256d t = _mm256_permute4x64_pd(v, _MM_SHUFFLE(1, 0, 3, 2));
+    v = _mm256_blend_pd(_mm256_min_pd(v, t), _mm256_max_pd(v, t), 0xC);
+    t = _mm256_permute_pd(v, 0x5);
+    return _mm256_blend_pd(_mm256_min_pd(v, t), _mm256_max_pd(v, t), 0xA);
+}
+
+// Une dois registradores ordenados em 8 elementos ordenados (a, b)
+ALVO_AVX2 inline void unir8(__m256d& a, __m256d& b) {
+    b = inverter(b);
+    compararTrocar(a, b);
+    a = limparBitonico4(a);
+    b = limparBitonico4(b);
+}
+
+// Une duas sequências ordenadas de 8 (a0 a1) e (b0 b1) em 16
+ALVO_AVX2 inline void unir16(__m256d& a0, __m256d& a1, __m256d& b0, __m256d& b1) {
+    __m256d c0 = inverter(b1);
+    __m256d c1 = inverter(b0);
+    compararTrocar(a0, c0);
+    compararTrocar(a1, c1);
+    
+    // a0 a1 e c0 c1 agora são bitônicas de 8: distância 4, depois 2 e 1
+    compararTrocar(a0, a1);
+    compararTrocar(c0, c1);
+    a0 = limparBitonico4(a0);
+    a1 = limparBitonico4(a1);
+    b0 = limparBitonico4(c0);
+    b1 = limparBitonico4(c1);
+}
+
+// Tabela de compactação: para cada máscara de 4 bits, índices (em lanes de
+// 32 bits) que levam os elementos marcados para o início, na ordem original
+struct TabelaCompactacao {
+    alignas(32) int32_t indices[16][8];
+
+    TabelaCompactacao() {
+        for (int mascara = 0; mascara < 16; mascara++) {
+            int k = 0;
+            for (int passo = 0; passo < 2; passo++) {
+                for (int lane = 0; lane < 4; lane++) {
+                    bool marcado = (mascara >> lane) & 1;
+                    if (marcado == (passo == 0)) {
+                        indices[mascara][2 * k] = 2 * lane;
+                        indices[mascara][2 * k + 1] = 2 * lane + 1;
+                        k++;
+                    }
+                }
+            }
+        }
+    }
+};
+
+const TabelaCompactacao TABELA_COMPACTACAO;
+
+// Grava v compactado nos dois lados: menores em esquerda, demais antes de direita
+ALVO_AVX2 inline void gravarParticionado(double* dados, __m256d v, __m256d pivo,
+                                          size_t& esquerda, size_t& direita) {
+    int mascara = _mm256_movemask_pd(_mm256_cmp_pd(v, pivo, _CMP_LT_OQ));
+    int menores = __builtin_popcount(mascara);
+    
+    __m256i indices = _mm256_load_si256(
+        reinterpret_cast<const __m256i*>(TABELA_COMPACTACAO.indices[mascara]));
+    __m256d compactado = _mm256_castps_pd(
+        _mm256_permutevar8x32_ps(_mm256_castpd_ps(v), indices));
+    
+    _mm256_storeu_pd(dados + esquerda, compactado);
+    _mm256_storeu_pd(dados + direita - 4, compactado);
+    esquerda += menores;
+    direita -= 4 - menores;
+}
+
+}
+
+ALVO_AVX2 void OrdenacaoSIMD::ordenarBlocoAVX2(double* dados, size_t n) {
+    // Completa o bloco com +inf para sempre executar a rede de 16
+    alignas(32) double bloco[TAMANHO_REDE];
+    copy(dados, dados + n, bloco);
+    fill(bloco + n, bloco + TAMANHO_REDE, numeric_limits<double>::infinity());
+    
+    __m256d r0 = _mm256_load_pd(bloco);
+    __m256d r1 = _mm256_load_pd(bloco + 4);
+    __m256d r2 = _mm256_load_pd(bloco + 8);
+    __m256d r3 = _mm256_load_pd(bloco + 12);
+    
+    // Rede ótima de 4 entradas aplicada às colunas da matriz 4x4
+    compararTrocar(r0, r1);
+    compararTrocar(r2, r3);
+    compararTrocar(r0, r2);
+    compararTrocar(r1, r3);
+    compararTrocar(r1, r2);
+    
+    // Transposição: cada registrador passa a conter uma coluna ordenada
+    __m256d t0 = _mm256_unpacklo_pd(r0, r1);
+    __m256d t1 = _mm256_unpackhi_pd(r0, r1);
+    __m256d t2 = _mm256_unpacklo_pd(r2, r3);
+    __m256d t3 = _mm256_unpackhi_pd(r2, r3);
+    r0 = _mm256_permute2f128_pd(t0, t2, 0x20);
+    r1 = _mm256_permute2f128_pd(t1, t3, 0x20);
+    r2 = _mm256_permute2f128_pd(t0, t2, 0x31);
+    r3 = _mm256_permute2f128_pd(t1, t3, 0x31);
+    
+    unir8(r0, r1);
+    unir8(r2, r3);
+    unir16(r0, r1, r2, r3);
+    
+    _mm256_store_pd(bloco, r0);
+    _mm256_store_pd(bloco + 4, r1);
+    _mm256_store_pd(bloco + 8, r2);
+    _mm256_store_pd(bloco + 12, r3);
+    copy(bloco, bloco + n, dados);
+}
+
+// Partição in-place sem desvios: os dois primeiros vetores (início e fim)
+// ficam em registradores, garantindo sempre pelo menos 4 posições livres
+// em cada lado para as gravações vetoriais completas
+ALVO_AVX2 size_t OrdenacaoSIMD::particionarAVX2(double* dados, size_t n, double pivo) {
+    if (n < 16) {
+        return particionarEscalar(dados, n, pivo);
+    }
+    
+    __m256d vetorPivo = _mm256_set1_pd(pivo);
+    __m256d bufferEsquerda = _mm256_loadu_pd(dados);
+    __m256d bufferDireita = _mm256_loadu_pd(dados + n - 4);
+    
+    size_t leituraEsquerda = 4, leituraDireita = n - 4;
+    size_t esquerda = 0, direita = n;
+    
+    while (leituraDireita - leituraEsquerda >= 4) {
+        __m256d v;
+        // Lê do lado com menos espaço livre
+        if (leituraEsquerda - esquerda <= direita - leituraDireita) {
+            v = _mm256_loadu_pd(dados + leituraEsquerda);
+            leituraEsquerda += 4;
+        } else {
+            leituraDireita -= 4;
+            v = _mm256_loadu_pd(dados + leituraDireita);
+        }
+        gravarParticionado(dados, v, vetorPivo, esquerda, direita);
+    }
+    
+    // Restante (até 3 elementos) e os dois vetores guardados: a região
+    // livre agora é contígua, então a gravação é escalar
+    alignas(32) double resto[11];
+    size_t numResto = leituraDireita - leituraEsquerda;
+    copy(dados + leituraEsquerda, dados + leituraDireita, resto);
+    _mm256_storeu_pd(resto + numResto, bufferEsquerda);
+    _mm256_storeu_pd(resto + numResto + 4, bufferDireita);
+    numResto += 8;
+    
+    for (size_t i = 0; i < numResto; i++) {
+        if (resto[i] < pivo) {
+            dados[esquerda++] = resto[i];
+        } else {
+            dados[--direita] = resto[i];
+        }
+    }
+    return esquerda;
+}
@@ -0,0 +1,32 @@
+#ifndef ORDENACAO_SIMD_H
+#define ORDENACAO_SIMD_H
+
+#include <cstddef>
+
+using namespace std;
+
+// Núcleos vetoriais (AVX2) para doubles, com fallback escalar.
+// O conjunto de instruções é detectado em tempo de execução, então o
+// binário continua rodando em CPUs sem AVX2.
+class OrdenacaoSIMD {
+public:
+    // Maior bloco tratado pela rede de ordenação
+    static const size_t TAMANHO_REDE = 16;
+
+    static bool avx2Disponivel();
+
+    // Ordena até TAMANHO_REDE elementos com rede bitônica em registradores
+    static void ordenarBloco(double* dados, size_t n);
+
+    // Particiona dados[0..n) em relação ao pivô: elementos < pivô ficam no
+    // início. Retorna quantos elementos são menores que o pivô.
+    static size_t particionar(double* dados, size_t n, double pivo);
+
+private:
+    static void ordenarBlocoEscalar(double* dados, size_t n);
+    static size_t particionarEscalar(double* dados, size_t n, double pivo);
+    static void ordenarBlocoAVX2(double* dados, size_t n);
+    static size_t particionarAVX2(double* dados, size_t n, double pivo);
+};
+
+#endif
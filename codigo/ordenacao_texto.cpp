@@ -0,0 +1,374 @@
+#include "ordenacao_texto.h"
+#include "arena_memoria.h"
+#include <algorithm>
+#include <cstring>
+#include <string>
+
+using namespace std;
+
+namespace {
+
+// Abaixo disso o insertion sort vence a partição / distribuição
+const size_t LIMIAR_INSERCAO_MULTIKEY = 16;
+const size_t LIMIAR_INSERCAO_RADIX = 32;
+
+// Pesos dos níveis secundário e terciário; 0x00 e 0x01 ficam reservados
+// para os separadores, então nenhum byte de chave é menor que 0x02
+const unsigned char SEPARADOR_NIVEL = 0x01;
+const unsigned char FIM_CHAVE = 0x00;
+const unsigned char PESO_NEUTRO = 0x02;     // sem acento / minúscula
+const unsigned char PESO_MAIUSCULA = 0x03;
+
+enum Acento : unsigned char {
+    NENHUM = PESO_NEUTRO, AGUDO, GRAVE, CIRCUNFLEXO, TIL, TREMA, CEDILHA, ANEL, BARRA
+};
+
+// Decomposição de U+00C0..U+00FF (Latin-1): letra base e acento; base 0
+// quando o caractere não se decompõe (Æ, Ð, ×, Þ, ß, ÷)
+struct Decomposicao {
+    char base;
+    Acento acento;
+};
+
+const Decomposicao LATIN1[64] = {
+    {'a', GRAVE}, {'a', AGUDO}, {'a', CIRCUNFLEXO}, {'a', TIL},
+    {'a', TREMA}, {'a', ANEL}, {0, NENHUM}, {'c', CEDILHA},
+    {'e', GRAVE}, {'e', AGUDO}, {'e', CIRCUNFLEXO}, {'e', TREMA},
+    {'i', GRAVE}, {'i', AGUDO}, {'i', CIRCUNFLEXO}, {'i', TREMA},
+    {0, NENHUM}, {'n', TIL}, {'o', GRAVE}, {'o', AGUDO},
+    {'o', CIRCUNFLEXO}, {'o', TIL}, {'o', TREMA}, {0, NENHUM},
+    {'o', BARRA}, {'u', GRAVE}, {'u', AGUDO}, {'u', CIRCUNFLEXO},
+    {'u', TREMA}, {'y', AGUDO}, {0, NENHUM}, {0, NENHUM},
+    {'a', GRAVE}, {'a', AGUDO}, {'a', CIRCUNFLEXO}, {'a', TIL},
+    {'a', TREMA}, {'a', ANEL}, {0, NENHUM}, {'c', CEDILHA},
+    {'e', GRAVE}, {'e', AGUDO}, {'e', CIRCUNFLEXO}, {'e', TREMA},
+    {'i', GRAVE}, {'i', AGUDO}, {'i', CIRCUNFLEXO}, {'i', TREMA},
+    {0, NENHUM}, {'n', TIL}, {'o', GRAVE}, {'o', AGUDO},
+    {'o', CIRCUNFLEXO}, {'o', TIL}, {'o', TREMA}, {0, NENHUM},
+    {'o', BARRA}, {'u', GRAVE}, {'u', AGUDO}, {'u', CIRCUNFLEXO},
+    {'u', TREMA}, {'y', AGUDO}, {0, NENHUM}, {'y', TREMA}};
+
+// Próximo code point de [p, fim); byte inválido vale como Latin-1
+uint32_t decodificarUTF8(const unsigned char*& p, const unsigned char* fim) {
+    unsigned char c = *p++;
+    if (c < 0x80) return c;
+
+    int continuacoes = c >= 0xF0 ? 3 : c >= 0xE0 ? 2 : c >= 0xC0 ? 1 : -1;
+    if (continuacoes < 0 || fim - p < continuacoes) return c;
+    uint32_t codigo = c & (0x3F >> continuacoes);
+    for (int k = 0; k < continuacoes; k++) {
+        if ((p[k] & 0xC0) != 0x80) return c;
+        codigo = (codigo << 6) | (p[k] & 0x3F);
+    }
+    p += continuacoes;
+    return codigo;
+}
+
+void codificarUTF8(uint32_t codigo, string& saida) {
+    if (codigo < 0x80) {
+        saida += static_cast<char>(codigo);
+    } else if (codigo < 0x800) {
+        saida += static_cast<char>(0xC0 | (codigo >> 6));
+        saida += static_cast<char>(0x80 | (codigo & 0x3F));
+    } else if (codigo < 0x10000) {
+        saida += static_cast<char>(0xE0 | (codigo >> 12));
+        saida += static_cast<char>(0x80 | ((codigo >> 6) & 0x3F));
+        saida += static_cast<char>(0x80 | (codigo & 0x3F));
+    } else {
+        saida += static_cast<char>(0xF0 | (codigo >> 18));
+        saida += static_cast<char>(0x80 | ((codigo >> 12) & 0x3F));
+        saida += static_cast<char>(0x80 | ((codigo >> 6) & 0x3F));
+        saida += static_cast<char>(0x80 | (codigo & 0x3F));
+    }
+}
+
+// Pesos de um caractere nos três níveis
+struct PesosCaractere {
+    uint32_t primario;          // code point da letra base, em minúscula
+    unsigned char secundario;   // acento
+    unsigned char terciario;    // maiúscula ou não
+};
+
+PesosCaractere pesosCaractere(uint32_t codigo) {
+    PesosCaractere pesos = {codigo, NENHUM, PESO_NEUTRO};
+    if (codigo >= 'A' && codigo <= 'Z') {
+        pesos.primario += 'a' - 'A';
+        pesos.terciario = PESO_MAIUSCULA;
+    } else if (codigo >= 0xC0 && codigo <= 0xFF) {
+        bool maiuscula = codigo <= 0xDE && codigo != 0xD7;
+        const Decomposicao& decomposicao = LATIN1[codigo - 0xC0];
+        if (decomposicao.base) {
+            pesos.primario = decomposicao.base;
+            pesos.secundario = decomposicao.acento;
+        } else if (maiuscula) {
+            pesos.primario += 0x20;     // Æ -> æ, Ð -> ð, Þ -> þ
+        }
+        if (maiuscula) pesos.terciario = PESO_MAIUSCULA;
+    }
+    if (pesos.primario < PESO_NEUTRO) pesos.primario = PESO_NEUTRO;
+    return pesos;
+}
+
+// Remove os pesos neutros do fim de um nível: como o neutro é o menor
+// peso e os níveis comparados têm o mesmo número de caracteres, a ordem
+// não muda e as chaves de textos sem acentos ficam mais curtas
+void removerNeutrosFinais(string& nivel) {
+    size_t fim = nivel.find_last_not_of(static_cast<char>(PESO_NEUTRO));
+    nivel.resize(fim == string::npos ? 0 : fim + 1);
+}
+
+// Byte na profundidade d, ou -1 depois do fim (o texto mais curto vem antes)
+inline int caractere(const unsigned char* base, const VisaoTexto& visao, size_t d) {
+    return d < visao.tamanho ? base[visao.inicio + d] : -1;
+}
+
+// Compara a partir da profundidade d; os dois textos têm ao menos d bytes
+inline int compararDesde(const unsigned char* base, const VisaoTexto& a, const VisaoTexto& b,
+                         size_t d) {
+    size_t restanteA = a.tamanho - d;
+    size_t restanteB = b.tamanho - d;
+    int ordem = memcmp(base + a.inicio + d, base + b.inicio + d, min(restanteA, restanteB));
+    if (ordem != 0) return ordem;
+    return restanteA < restanteB ? -1 : restanteA > restanteB;
+}
+
+}
+
+void OrdenacaoTexto::stdSort(ColunaTexto& coluna) {
+    const unsigned char* base = reinterpret_cast<const unsigned char*>(coluna.base());
+    sort(coluna.visoes().begin(), coluna.visoes().end(),
+         [base](const VisaoTexto& a, const VisaoTexto& b) {
+             return compararDesde(base, a, b, 0) < 0;
+         });
+}
+
+void OrdenacaoTexto::multikeyQuicksort(ColunaTexto& coluna) {
+    multikeyQuicksort(reinterpret_cast<const unsigned char*>(coluna.base()),
+                      coluna.visoes().data(), coluna.size(), 0);
+}
+
+void OrdenacaoTexto::msdRadixSort(ColunaTexto& coluna) {
+    ArenaMemoria& arena = ArenaMemoria::daThread();
+    ArenaMemoria::Escopo escopo(arena);
+    VisaoTexto* auxiliar = arena.alocar<VisaoTexto>(coluna.size());
+    msdRadixSort(reinterpret_cast<const unsigned char*>(coluna.base()),
+                 coluna.visoes().data(), coluna.size(), 0, auxiliar);
+}
+
+void OrdenacaoTexto::insertionSort(const unsigned char* base, VisaoTexto* visoes, size_t n,
+                                   size_t profundidade) {
+    for (size_t i = 1; i < n; i++) {
+        VisaoTexto atual = visoes[i];
+        size_t j = i;
+        for (; j > 0 && compararDesde(base, atual, visoes[j - 1], profundidade) < 0; j--) {
+            visoes[j] = visoes[j - 1];
+        }
+        visoes[j] = atual;
+    }
+}
+
+void OrdenacaoTexto::multikeyQuicksort(const unsigned char* base, VisaoTexto* visoes, size_t n,
+                                       size_t profundidade) {
+    // O grupo "=" continua no laço com profundidade + 1; só "<" e ">"
+    // recursam
+    while (n > LIMIAR_INSERCAO_MULTIKEY) {
+        int a = caractere(base, visoes[0], profundidade);
+        int b = caractere(base, visoes[n / 2], profundidade);
+        int c = caractere(base, visoes[n - 1], profundidade);
+        int pivo = max(min(a, b), min(max(a, b), c));
+
+        // Partição de Dijkstra: [0, menor) < pivô, [menor, i) = pivô,
+        // [maior, n) > pivô
+        size_t menor = 0, i = 0, maior = n;
+        while (i < maior) {
+            int atual = caractere(base, visoes[i], profundidade);
+            if (atual < pivo) {
+                swap(visoes[menor++], visoes[i++]);
+            } else if (atual > pivo) {
+                swap(visoes[i], visoes[--maior]);
+            } else {
+                i++;
+            }
+        }
+
+        multikeyQuicksort(base, visoes, menor, profundidade);
+        multikeyQuicksort(base, visoes + maior, n - maior, profundidade);
+
+        // Pivô -1: o grupo "=" são textos que terminaram, todos iguais
+        if (pivo < 0) return;
+        visoes += menor;
+        n = maior - menor;
+        profundidade++;
+    }
+    insertionSort(base, visoes, n, profundidade);
+}
+
+void OrdenacaoTexto::msdRadixSort(const unsigned char* base, VisaoTexto* visoes, size_t n,
+                                  size_t profundidade, VisaoTexto* auxiliar) {
+    while (n >= LIMIAR_INSERCAO_RADIX) {
+        // Balde 0: textos que terminaram; balde b: byte b - 1
+        size_t contagem[257] = {};
+        for (size_t i = 0; i < n; i++) contagem[caractere(base, visoes[i], profundidade) + 1]++;
+
+        // Prefixo comum a todo o grupo: desce sem distribuir
+        int unico = -1;
+        for (int balde = 0; balde < 257 && unico < 0; balde++) {
+            if (contagem[balde] == n) unico = balde;
+        }
+        if (unico == 0) return;
+        if (unico > 0) {
+            profundidade++;
+            continue;
+        }
+
+        size_t inicio[257];
+        size_t acumulado = 0;
+        for (int balde = 0; balde < 257; balde++) {
+            inicio[balde] = acumulado;
+            acumulado += contagem[balde];
+        }
+        for (size_t i = 0; i < n; i++) {
+            auxiliar[inicio[caractere(base, visoes[i], profundidade) + 1]++] = visoes[i];
+        }
+        memcpy(visoes, auxiliar, n * sizeof(VisaoTexto));
+
+        // inicio[b] agora é o fim do balde b; o balde 0 já está pronto.
+        // Recursão só nos baldes menores (cada um com no máximo n/2
+        // textos, então a profundidade fica em log2(n) quadros de ~4 KB
+        // mesmo com prefixos comuns longos); o maior continua no laço.
+        int maior = 1;
+        for (int balde = 2; balde < 257; balde++) {
+            if (contagem[balde] > contagem[maior]) maior = balde;
+        }
+        for (int balde = 1; balde < 257; balde++) {
+            size_t tamanho = contagem[balde];
+            if (balde != maior && tamanho > 1) {
+                size_t primeiro = inicio[balde] - tamanho;
+                msdRadixSort(base, visoes + primeiro, tamanho, profundidade + 1,
+                             auxiliar + primeiro);
+            }
+        }
+        size_t primeiro = inicio[maior] - contagem[maior];
+        visoes += primeiro;
+        auxiliar += primeiro;
+        n = contagem[maior];
+        profundidade++;
+    }
+    insertionSort(base, visoes, n, profundidade);
+}
+
+bool OrdenacaoTexto::verificarOrdenacao(const ColunaTexto& coluna) {
+    const unsigned char* base = reinterpret_cast<const unsigned char*>(coluna.base());
+    const vector<VisaoTexto>& visoes = coluna.visoes();
+    for (size_t i = 1; i < visoes.size(); i++) {
+        if (compararDesde(base, visoes[i], visoes[i - 1], 0) < 0) return false;
+    }
+    return true;
+}
+
+ColunaTexto OrdenacaoTexto::gerarChaves(const ColunaTexto& coluna, Colacao colacao) {
+    ColunaTexto chaves;
+    chaves.nome = coluna.nome;
+    chaves.reservar(coluna.size(), coluna.bytes() * 3 + coluna.size() * 8);
+
+    string chave, secundario, terciario;
+    for (size_t linha = 0; linha < coluna.size(); linha++) {
+        string_view texto = coluna[linha];
+        chave.clear();
+        secundario.clear();
+        terciario.clear();
+
+        if (colacao == Colacao::Binaria) {
+            chave.assign(texto.data(), texto.size());
+        } else {
+            const unsigned char* p = reinterpret_cast<const unsigned char*>(texto.data());
+            const unsigned char* fim = p + texto.size();
+            while (p < fim) {
+                PesosCaractere pesos = pesosCaractere(decodificarUTF8(p, fim));
+                codificarUTF8(pesos.primario, chave);
+                secundario += static_cast<char>(pesos.secundario);
+                terciario += static_cast<char>(pesos.terciario);
+            }
+
+            if (colacao >= Colacao::Secundaria) {
+                removerNeutrosFinais(secundario);
+                chave += static_cast<char>(SEPARADOR_NIVEL);
+                chave += secundario;
+            }
+            if (colacao == Colacao::Terciaria) {
+                removerNeutrosFinais(terciario);
+                chave += static_cast<char>(SEPARADOR_NIVEL);
+                chave += terciario;
+            }
+        }
+
+        chave += static_cast<char>(FIM_CHAVE);
+        uint32_t indice = static_cast<uint32_t>(linha);
+        for (int deslocamento = 24; deslocamento >= 0; deslocamento -= 8) {
+            chave += static_cast<char>((indice >> deslocamento) & 0xFF);
+        }
+        chaves.adicionar(chave);
+    }
+    return chaves;
+}
+
+int OrdenacaoTexto::compararColacao(string_view a, string_view b, Colacao colacao) {
+    const unsigned char* p = reinterpret_cast<const unsigned char*>(a.data());
+    const unsigned char* q = reinterpret_cast<const unsigned char*>(b.data());
+    const unsigned char* fimA = p + a.size();
+    const unsigned char* fimB = q + b.size();
+
+    if (colacao == Colacao::Binaria) {
+        int ordem = memcmp(p, q, min(a.size(), b.size()));
+        if (ordem != 0) return ordem < 0 ? -1 : 1;
+        return a.size() < b.size() ? -1 : a.size() > b.size();
+    }
+
+    // Uma passada: a primeira diferença primária decide; as primeiras
+    // diferenças secundária e terciária ficam guardadas para o empate
+    int secundario = 0, terciario = 0;
+    while (p < fimA && q < fimB) {
+        PesosCaractere x = pesosCaractere(decodificarUTF8(p, fimA));
+        PesosCaractere y = pesosCaractere(decodificarUTF8(q, fimB));
+        if (x.primario != y.primario) return x.primario < y.primario ? -1 : 1;
+        if (!secundario && x.secundario != y.secundario) {
+            secundario = x.secundario < y.secundario ? -1 : 1;
+        }
+        if (!terciario && x.terciario != y.terciario) {
+            terciario = x.terciario < y.terciario ? -1 : 1;
+        }
+    }
+    if (p < fimA) return 1;
+    if (q < fimB) return -1;
+    if (colacao >= Colacao::Secundaria && secundario) return secundario;
+    return colacao == Colacao::Terciaria ? terciario : 0;
+}
+
+vector<size_t> OrdenacaoTexto::linhasDasChaves(const ColunaTexto& chaves) {
+    vector<size_t> linhas(chaves.size());
+    for (size_t i = 0; i < chaves.size(); i++) {
+        string_view chave = chaves[i];
+        const unsigned char* indice =
+            reinterpret_cast<const unsigned char*>(chave.data() + chave.size() - 4);
+        linhas[i] = (uint32_t(indice[0]) << 24) | (uint32_t(indice[1]) << 16) |
+                    (uint32_t(indice[2]) << 8) | indice[3];
+    }
+    return linhas;
+}
+
+vector<size_t> OrdenacaoTexto::ordenarPorColacao(const ColunaTexto& coluna, Colacao colacao,
+                                                 const function<void(ColunaTexto&)>& ordenar) {
+    ColunaTexto chaves = gerarChaves(coluna, colacao);
+    ordenar(chaves);
+    return linhasDasChaves(chaves);
+}
+
+const char* OrdenacaoTexto::nomeColacao(Colacao colacao) {
+    switch (colacao) {
+        case Colacao::Binaria: return "binária";
+        case Colacao::Primaria: return "primária";
+        case Colacao::Secundaria: return "secundária";
+        case Colacao::Terciaria: return "terciária";
+    }
+    return "";
+}
@@ -0,0 +1,70 @@
+#ifndef ORDENACAO_TEXTO_H
+#define ORDENACAO_TEXTO_H
+
+#include <cstddef>
+#include <functional>
+#include <string_view>
+#include <vector>
+#include "coluna_texto.h"
+
+using namespace std;
+
+// Níveis de comparação no sentido do UCA (como as opções do Calc):
+// - Binaria: bytes UTF-8 (ordem dos code points)
+// - Primaria: só a letra base; ignora acentos e maiúsculas ("Ação" = "acao")
+// - Secundaria: letra base, depois acentos; ignora maiúsculas
+// - Terciaria: letra base, acentos e por fim maiúsculas (minúscula antes)
+enum class Colacao { Binaria, Primaria, Secundaria, Terciaria };
+
+// Ordenações de colunas de texto. Todas permutam as visões da coluna em
+// ordem crescente de bytes (memcmp, com o prefixo antes do mais longo).
+class OrdenacaoTexto {
+public:
+    // std::sort das visões com comparação por memcmp (linha de base)
+    static void stdSort(ColunaTexto& coluna);
+
+    // Quicksort de três vias sobre o caractere na profundidade d
+    // (Bentley & Sedgewick, 1997): cada byte de prefixo comum é
+    // examinado uma vez na partição "=", não a cada comparação
+    static void multikeyQuicksort(ColunaTexto& coluna);
+
+    // Radix sort MSD: distribui pelo byte na profundidade d em 257 baldes
+    // (fim do texto + 256 bytes) e desce em cada balde; grupos pequenos
+    // vão para o insertion sort a partir da mesma profundidade
+    static void msdRadixSort(ColunaTexto& coluna);
+
+    static bool verificarOrdenacao(const ColunaTexto& coluna);
+
+    // Chave de ordenação de cada linha (na ordem da coluna): os níveis
+    // pedidos em bytes, separados por 0x01, terminados por 0x00 e pelo
+    // índice da linha em big-endian. memcmp das chaves dá a ordem da
+    // colação, com empates desfeitos pela posição original (estável).
+    static ColunaTexto gerarChaves(const ColunaTexto& coluna, Colacao colacao);
+
+    // Comparação direta na colação (-1, 0, 1), sem chaves: mesma ordem
+    // das chaves, mas refaz a decomposição a cada chamada
+    static int compararColacao(string_view a, string_view b, Colacao colacao);
+
+    // Depois de ordenar as chaves: linha original de cada posição
+    static vector<size_t> linhasDasChaves(const ColunaTexto& chaves);
+
+    // Gera as chaves, ordena com o algoritmo dado e devolve a permutação
+    // (posição final -> linha original), como OrdenacaoMultiChave
+    static vector<size_t> ordenarPorColacao(const ColunaTexto& coluna, Colacao colacao,
+                                            const function<void(ColunaTexto&)>& ordenar);
+
+    static const char* nomeColacao(Colacao colacao);
+
+private:
+    static void multikeyQuicksort(const unsigned char* base, VisaoTexto* visoes, size_t n,
+                                  size_t profundidade);
+    static void msdRadixSort(const unsigned char* base, VisaoTexto* visoes, size_t n,
+                             size_t profundidade, VisaoTexto* auxiliar);
+
+    // Insertion sort comparando a partir de 'profundidade' (os bytes
+    // anteriores são iguais em todo o grupo)
+    static void insertionSort(const unsigned char* base, VisaoTexto* visoes, size_t n,
+                              size_t profundidade);
+};
+
+#endif
@@ -0,0 +1,133 @@
+#include "pool_tarefas.h"
+#include <map>
+
+using namespace std;
+
+namespace {
+// Identifica em qual pool (e em qual fila) a thread atual trabalha
+thread_local const PoolTarefas* poolAtual = nullptr;
+thread_local size_t filaAtual = 0;
+}
+
+PoolTarefas::PoolTarefas(unsigned numThreads) : parar(false), tarefasNaFila(0), aguardando(0) {
+    if (numThreads == 0) {
+        numThreads = max(1u, thread::hardware_concurrency());
+    }
+
+    for (unsigned i = 0; i < numThreads; i++) {
+        filas.push_back(make_unique<Fila>());
+    }
+
+    // A fila 0 pertence às threads externas que chamam aguardar()
+    for (unsigned i = 1; i < numThreads; i++) {
+        threads.emplace_back(&PoolTarefas::loopTrabalhador, this, i);
+    }
+}
+
+PoolTarefas::~PoolTarefas() {
+    {
+        lock_guard<mutex> lock(mSono);
+        parar = true;
+    }
+    cvSono.notify_all();
+    for (auto& t : threads) {
+        t.join();
+    }
+}
+
+size_t PoolTarefas::indiceFilaAtual() const {
+    return poolAtual == this ? filaAtual : 0;
+}
+
+void PoolTarefas::submeter(Tarefa tarefa) {
+    Fila& fila = *filas[indiceFilaAtual()];
+    {
+        lock_guard<mutex> lock(fila.m);
+        fila.tarefas.push_back(move(tarefa));
+    }
+    {
+        lock_guard<mutex> lock(mSono);
+        tarefasNaFila++;
+    }
+    cvSono.notify_one();
+    if (aguardando > 0) cvConclusao.notify_all();
+}
+
+bool PoolTarefas::tentarExecutar(size_t indice) {
+    Tarefa tarefa;
+
+    // Primeiro a própria fila (fim), depois roubo das outras (início)
+    for (size_t k = 0; k < filas.size() && !tarefa; k++) {
+        Fila& fila = *filas[(indice + k) % filas.size()];
+        lock_guard<mutex> lock(fila.m);
+        if (fila.tarefas.empty()) continue;
+
+        if (k == 0) {
+            tarefa = move(fila.tarefas.back());
+            fila.tarefas.pop_back();
+        } else {
+            tarefa = move(fila.tarefas.front());
+            fila.tarefas.pop_front();
+        }
+    }
+
+    if (!tarefa) return false;
+
+    tarefasNaFila--;
+    tarefa();
+
+    // A tarefa pode ter zerado o contador de alguém em aguardar(). O lock
+    // fecha a janela entre o teste do predicado e o wait do outro lado.
+    if (aguardando > 0) {
+        lock_guard<mutex> lock(mSono);
+        cvConclusao.notify_all();
+    }
+    return true;
+}
+
+void PoolTarefas::loopTrabalhador(size_t indice) {
+    poolAtual = this;
+    filaAtual = indice;
+
+    while (true) {
+        if (tentarExecutar(indice)) continue;
+
+        unique_lock<mutex> lock(mSono);
+        cvSono.wait(lock, [this] { return parar || tarefasNaFila > 0; });
+        if (parar) return;
+    }
+}
+
+void PoolTarefas::aguardar(const atomic<size_t>& pendentes) {
+    const PoolTarefas* poolAnterior = poolAtual;
+    size_t filaAnterior = filaAtual;
+    size_t indice = indiceFilaAtual();
+    poolAtual = this;
+    filaAtual = indice;
+
+    while (pendentes.load() > 0) {
+        if (tentarExecutar(indice)) continue;
+
+        unique_lock<mutex> lock(mSono);
+        aguardando++;
+        cvConclusao.wait(lock, [&] { return pendentes.load() == 0 || tarefasNaFila > 0; });
+        aguardando--;
+    }
+
+    poolAtual = poolAnterior;
+    filaAtual = filaAnterior;
+}
+
+PoolTarefas& PoolTarefas::compartilhado(unsigned numThreads) {
+    static map<unsigned, unique_ptr<PoolTarefas>> pools;
+    static mutex m;
+
+    if (numThreads == 0) {
+        numThreads = max(1u, thread::hardware_concurrency());
+    }
+
+    lock_guard<mutex> lock(m);
+    unique_ptr<PoolTarefas>& pool = pools[numThreads];
+    if (!pool) pool = make_unique<PoolTarefas>(numThreads);
+    return *pool;
+}
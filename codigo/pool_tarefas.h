@@ -0,0 +1,68 @@
+#ifndef POOL_TAREFAS_H
+#define POOL_TAREFAS_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+// Pool de threads com roubo de tarefas (work-stealing).
+// Cada trabalhador possui sua própria fila: retira tarefas do fim da sua
+// fila (LIFO, melhor localidade) e rouba do início das filas alheias (FIFO).
+class PoolTarefas {
+public:
+    using Tarefa = function<void()>;
+
+    // numThreads = 0 usa hardware_concurrency(). A thread que chama
+    // aguardar() também executa tarefas, então são criadas numThreads - 1
+    // threads de fundo.
+    explicit PoolTarefas(unsigned numThreads = 0);
+    ~PoolTarefas();
+
+    PoolTarefas(const PoolTarefas&) = delete;
+    PoolTarefas& operator=(const PoolTarefas&) = delete;
+
+    unsigned numThreads() const { return static_cast<unsigned>(filas.size()); }
+
+    void submeter(Tarefa tarefa);
+
+    // Executa tarefas até que o contador de pendentes chegue a zero
+    // (ponto de junção do modelo fork-join). Sem tarefa para executar,
+    // dorme até outra tarefa terminar ou entrar numa fila.
+    void aguardar(const atomic<size_t>& pendentes);
+
+    // Pool reutilizável entre chamadas, um por número de threads. Nenhum
+    // é destruído antes do fim do programa: referências obtidas antes
+    // continuam válidas mesmo que outra chamada peça outro tamanho.
+    static PoolTarefas& compartilhado(unsigned numThreads = 0);
+
+private:
+    struct Fila {
+        mutex m;
+        deque<Tarefa> tarefas;
+    };
+
+    vector<unique_ptr<Fila>> filas;
+    vector<thread> threads;
+    atomic<bool> parar;
+    atomic<size_t> tarefasNaFila;
+    mutex mSono;
+    condition_variable cvSono;
+
+    // Threads em aguardar() sem tarefa; as notificações de conclusão só
+    // são feitas quando há alguma
+    atomic<size_t> aguardando;
+    condition_variable cvConclusao;
+
+    bool tentarExecutar(size_t indice);
+    void loopTrabalhador(size_t indice);
+    size_t indiceFilaAtual() const;
+};
+
+#endif
@@ -0,0 +1,142 @@
+#ifndef SEQUENCIAS_SHELL_H
+#define SEQUENCIAS_SHELL_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+using namespace std;
+
+// Sequências de gaps do Shell Sort como políticas de compilação. Cada uma
+// oferece percorrer(n, f), que chama f(gap) do maior gap < n até 1. As
+// sequências fixas são tabelas constexpr (gaps até 2^40), calculadas pelo
+// compilador; só a de Shell depende de n.
+namespace ordenacao {
+
+namespace detalhe_gaps {
+
+constexpr int64_t LIMITE = int64_t(1) << 40;
+
+template <size_t N>
+struct TabelaGaps {
+    array<int64_t, N> gaps{};
+    size_t tamanho = 0;
+
+    constexpr void adicionar(int64_t gap) { gaps[tamanho++] = gap; }
+};
+
+// Maior gap < n primeiro, depois os menores
+template <size_t N, class F>
+void percorrerTabela(const TabelaGaps<N>& tabela, ptrdiff_t n, F&& f) {
+    size_t k = 0;
+    while (k < tabela.tamanho && tabela.gaps[k] < n) k++;
+    while (k-- > 0) f(static_cast<ptrdiff_t>(tabela.gaps[k]));
+}
+
+// Knuth (1973): 1, 4, 13, 40, ... (h = 3h + 1)
+constexpr TabelaGaps<32> gerarKnuth() {
+    TabelaGaps<32> tabela;
+    for (int64_t h = 1; h <= LIMITE; h = 3 * h + 1) tabela.adicionar(h);
+    return tabela;
+}
+
+// Sedgewick (1986): 9*4^k - 9*2^k + 1 intercalado com 4^k - 3*2^k + 1
+// (1, 5, 19, 41, 109, 209, 505, 929, ...)
+constexpr TabelaGaps<48> gerarSedgewick() {
+    TabelaGaps<48> tabela;
+    tabela.adicionar(1);
+    for (int k = 1; k < 24; k++) {
+        int64_t impar = (int64_t(1) << (2 * k + 2)) - 3 * (int64_t(1) << (k + 1)) + 1;
+        int64_t par = 9 * (int64_t(1) << (2 * k)) - 9 * (int64_t(1) << k) + 1;
+        if (impar > LIMITE) break;
+        tabela.adicionar(impar);
+        if (par > LIMITE) break;
+        tabela.adicionar(par);
+    }
+    return tabela;
+}
+
+// Tokuda (1992): h = teto(h'), h' = 2.25 h' + 1 (1, 4, 9, 20, 46, 103, ...)
+constexpr TabelaGaps<48> gerarTokuda() {
+    TabelaGaps<48> tabela;
+    for (double h = 1; h <= LIMITE; h = 2.25 * h + 1) {
+        int64_t teto = static_cast<int64_t>(h);
+        tabela.adicionar(teto < h ? teto + 1 : teto);
+    }
+    return tabela;
+}
+
+// Ciura (2001), obtida empiricamente até 1750 e estendida com h = 2.25 h
+constexpr TabelaGaps<48> gerarCiura() {
+    TabelaGaps<48> tabela;
+    const int64_t base[] = {1, 4, 10, 23, 57, 132, 301, 701, 1750};
+    for (int64_t gap : base) tabela.adicionar(gap);
+    for (int64_t h = 1750 * 9 / 4; h <= LIMITE; h = h * 9 / 4) tabela.adicionar(h);
+    return tabela;
+}
+
+// Pratt (1971): todos os 2^p 3^q em ordem crescente; O(n log² n)
+// garantido, mas com O(log² n) passadas
+constexpr TabelaGaps<640> gerarPratt() {
+    TabelaGaps<640> tabela;
+    for (int64_t potencia2 = 1; potencia2 <= LIMITE; potencia2 *= 2) {
+        for (int64_t gap = potencia2; gap <= LIMITE; gap *= 3) tabela.adicionar(gap);
+    }
+    // Insertion sort em tempo de compilação
+    for (size_t i = 1; i < tabela.tamanho; i++) {
+        int64_t gap = tabela.gaps[i];
+        size_t j = i;
+        for (; j > 0 && tabela.gaps[j - 1] > gap; j--) tabela.gaps[j] = tabela.gaps[j - 1];
+        tabela.gaps[j] = gap;
+    }
+    return tabela;
+}
+
+}
+
+// Shell (1959): n/2, n/4, ..., 1
+struct SequenciaShell {
+    template <class F>
+    static void percorrer(ptrdiff_t n, F&& f) {
+        for (ptrdiff_t gap = n / 2; gap > 0; gap /= 2) f(gap);
+    }
+};
+
+struct SequenciaKnuth {
+    static constexpr detalhe_gaps::TabelaGaps<32> tabela = detalhe_gaps::gerarKnuth();
+
+    template <class F>
+    static void percorrer(ptrdiff_t n, F&& f) { detalhe_gaps::percorrerTabela(tabela, n, f); }
+};
+
+struct SequenciaSedgewick {
+    static constexpr detalhe_gaps::TabelaGaps<48> tabela = detalhe_gaps::gerarSedgewick();
+
+    template <class F>
+    static void percorrer(ptrdiff_t n, F&& f) { detalhe_gaps::percorrerTabela(tabela, n, f); }
+};
+
+struct SequenciaTokuda {
+    static constexpr detalhe_gaps::TabelaGaps<48> tabela = detalhe_gaps::gerarTokuda();
+
+    template <class F>
+    static void percorrer(ptrdiff_t n, F&& f) { detalhe_gaps::percorrerTabela(tabela, n, f); }
+};
+
+struct SequenciaCiura {
+    static constexpr detalhe_gaps::TabelaGaps<48> tabela = detalhe_gaps::gerarCiura();
+
+    template <class F>
+    static void percorrer(ptrdiff_t n, F&& f) { detalhe_gaps::percorrerTabela(tabela, n, f); }
+};
+
+struct SequenciaPratt {
+    static constexpr detalhe_gaps::TabelaGaps<640> tabela = detalhe_gaps::gerarPratt();
+
+    template <class F>
+    static void percorrer(ptrdiff_t n, F&& f) { detalhe_gaps::percorrerTabela(tabela, n, f); }
+};
+
+}
+
+#endif
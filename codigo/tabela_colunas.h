@@ -0,0 +1,19 @@
+#ifndef TABELA_COLUNAS_H
+#define TABELA_COLUNAS_H
+
+#include <string>
+#include <vector>
+
+using namespace std;
+
+// Tabela em formato struct-of-arrays: uma coluna contígua por campo,
+// todas com o mesmo número de linhas
+struct TabelaColunas {
+    vector<string> nomes;
+    vector<vector<double>> colunas;
+
+    size_t numLinhas() const { return colunas.empty() ? 0 : colunas[0].size(); }
+    size_t numColunas() const { return colunas.size(); }
+};
+
+#endif